@@ -2,6 +2,12 @@
 #include <ILI9488_t3.h>
 #include <Wire.h>
 #include <FT6236G.h>
+#include "compositor.h"
+#include "sprite_cache.h"
+#include "touch_queue.h"
+#include "timer_wheel.h"
+#include "entities.h"
+#include "telemetry.h"
 
 // Define pins for the TFT display
 #define TFT_CS     10
@@ -14,11 +20,35 @@
 #define CTP_ADDR   0x38
 
 // Create display instance
-ILI9488_t3 tft = ILI9488_t3(TFT_CS, TFT_DC, TFT_RST);
+ILI9488_t3 panel = ILI9488_t3(TFT_CS, TFT_DC, TFT_RST);
+
+// All game drawing goes through the compositor, which batches it into
+// dirty-rectangle pushes to the panel once per frame
+Compositor tft(panel);
 
 // Create touch instance
 FT6236G ts;
 
+// Touch events queued from the CTP_INT interrupt
+TouchQueue touchInput;
+
+// Typed events for the host instead of Serial text. On a Teensy the USB
+// serial port ignores the baud rate; point TELEMETRY_PORT at Serial1 to
+// stream from a hardware UART at TELEMETRY_BAUD instead.
+#ifndef TELEMETRY_PORT
+#define TELEMETRY_PORT Serial
+#endif
+#ifndef TELEMETRY_BAUD
+#define TELEMETRY_BAUD 2000000
+#endif
+
+Telemetry telemetry;
+
+// Set to 0 to draw every character procedurally (for A/B comparisons)
+#ifndef SPRITE_CACHE_ENABLED
+#define SPRITE_CACHE_ENABLED 1
+#endif
+
 // Define colors (inverted from original)
 #define BLACK     0xFFFF  // Was 0x0000 (now white)
 #define WHITE     0x0000  // Was 0xFFFF (now black)
@@ -68,6 +98,22 @@ enum GameVariant {
   BONK_DRAGONS  // Nolan's How to Train Your Dragon variant!
 };
 
+// Sprite cache kinds - one per deterministic character drawing
+enum SpriteKind {
+  SPRITE_CHICKEN,
+  SPRITE_BUNNY,
+  SPRITE_FLAG,
+  SPRITE_BLUEY,
+  SPRITE_BINGO,
+  SPRITE_TOOTHLESS,
+  SPRITE_LIGHT_FURY,
+  SPRITE_SPECIAL_CHICKEN,
+  SPRITE_STAR,
+  SPRITE_BALLOON,
+  SPRITE_FISH
+};
+#define SPRITE_WITH_FLAMES 0x80  // Dragons cache their plasma glow separately
+
 // Game variables
 GameState currentState = LOAD_SCREEN;
 GameDifficulty gameDifficulty = EASY;
@@ -94,12 +140,11 @@ int timeLeft = 45;
 unsigned long lastChickenTime = 0;
 unsigned long lastTimerUpdate = 0;
 
-// Game object variables
-int chickenX, chickenY;
+// Game object variables. Positions, lifetimes and grace periods live in
+// the entity pool; these are the sizes the draw functions use.
 const int initialChickenSize = 40;
 int currentChickenSize = initialChickenSize;
-bool chickenVisible = false;
-unsigned long lastTapTime = 0;
+unsigned long lastTapTime[FT6236_MAX_TOUCHES] = {0, 0};  // micros() of last accepted tap per finger
 const int debounceDelay = 200;
 bool showFeedback = false;
 unsigned long feedbackTime = 0;
@@ -108,22 +153,18 @@ unsigned long feedbackTime = 0;
 bool showFrenzyText = false;
 unsigned long frenzyTextTime = 0;
 
-// Variables for chicken tap timing
-int lastChickenX = 0;
-int lastChickenY = 0;
-unsigned long chickenDisappearTime = 0;
-unsigned long afterDisappearGracePeriod = 800;
+// EASY mode still counts a tap this long after a character disappears
+const unsigned long easyGracePeriod = 800;
 
 // Variables for second chicken (level 2)
-int specialChickenX, specialChickenY;
-bool specialChickenVisible = false;
 unsigned long lastSpecialChickenTime = 0;
 int specialChickenSize = 30;
-int lastSpecialChickenX = 0;
-int lastSpecialChickenY = 0;
-unsigned long specialChickenDisappearTime = 0;
 bool showSpecialChicken = false;
 
+// Where the special character's hit text went, cleared with the frenzy text
+int specialTextX = 0;
+int specialTextY = 0;
+
 // Progressive difficulty variables
 int initialChickenDuration = 1000;
 int currentChickenDuration = initialChickenDuration;
@@ -138,18 +179,71 @@ bool frenzyMode = false;
 unsigned long frenzyStartTime = 0;
 const int frenzyDuration = 3000;
 
+// Dragons plasma beam, fired from the character that was just hit
+float plasmaAngle = 0;
+int plasmaStartX = 0;
+int plasmaStartY = 0;
+int lastBeamEndX = 0;
+int lastBeamEndY = 0;
+int lastBeamLength = 0;
+
+// Everything timed is a deadline in the timer wheel, one ID per effect
+enum GameTimer {
+  TIMER_STATE,       // Splash screen phases, result screen timeout
+  TIMER_BLINK,       // Flashing PRESS START prompt
+  TIMER_CLOCK,       // One-second countdown
+  TIMER_CHARACTER,   // Regular character spawn / despawn
+  TIMER_SPECIAL,     // Special character spawn / despawn
+  TIMER_WANDER,      // SHRED GNAR special character movement
+  TIMER_FEEDBACK,    // Green hit flash
+  TIMER_PLASMA,      // Dragons plasma beam
+  TIMER_FRENZY,      // Frenzy mode expiry
+  TIMER_TEXT,        // Frenzy / special hit text
+  TIMER_COUNT
+};
+
+// Handlers timed into telemetry besides the GameTimer callbacks
+#define HANDLER_TOUCH TIMER_COUNT  // checkTouchEvents() passes that read the panel or had events
+
+// With nothing scheduled, still wake this often
+#define IDLE_MAX_SLEEP_MS 250
+
+TimerWheel<TIMER_COUNT> timers;
+
+// Every character on the playfield is an entry in the entity pool
+enum CharacterKind {
+  CHARACTER_REGULAR,   // Checked first when a tap covers both
+  CHARACTER_SPECIAL
+};
+
+// Taps count this far outside a character's box
+#define TAP_MARGIN        40
+// Characters never spawn bigger than this (SHRED GNAR goes up to 59)
+#define MAX_CHARACTER_SIZE 60
+// Space kept between characters when placing a new one
+#define CHARACTER_GAP     20
+
+EntityPool characters;
+EntityId chickenId = ENTITY_NONE;         // The regular character, if showing
+EntityId specialChickenId = ENTITY_NONE;  // The special character, if showing
+
 // Function prototypes
 void transformTouchCoordinates(uint16_t *x, uint16_t *y);
-void handleLoadScreen();
-void handleGameSelection();
-void handlePlayerSelection();
-void handleModeSelectionP1();
-void handlePressStartP1();
-void handleGameplayP1();
-void handleModeSelectionP2();
-void handlePressStartP2();
-void handleGameplayP2();
-void handleResultScreen();
+void enterState(GameState next);
+void enterLoadScreen();
+void advanceLoadScreen();
+void enterGameSelection();
+void enterPlayerSelection();
+void enterModeSelectionP1();
+void enterPressStartP1();
+void enterModeSelectionP2();
+void enterPressStartP2();
+void blinkStartPrompt();
+void enterResultScreen();
+void leaveResultScreen();
+void sleepUntilNextEvent();
+void flushFrame(bool force = false);
+void profileTimer(uint8_t id, uint32_t startUs);
 void drawChicken(int x, int y, bool withFlames);
 void drawBunny(int x, int y, bool withFlames);
 void drawFlag(int x, int y, bool withFlames);
@@ -162,8 +256,12 @@ void drawStar(int x, int y);
 void drawBalloon(int x, int y);
 void drawFish(int x, int y);  // Fish for dragons to collect!
 void clearCharacter(int x, int y, int size);
-bool isTapInCharacter(int tapX, int tapY, int checkX, int checkY, int size);
+int characterRandom(int lo, int hi);
+void spawnCharacter(int kind, int size, EntityId *id);
+void despawnCharacter(EntityId *id, unsigned long now);
 void checkTouchEvents();
+void handleTap(uint16_t x, uint16_t y, unsigned long capturedAt);
+void logTapResult(EntityId hit, uint16_t x, uint16_t y, unsigned long capturedAt);
 void updateScoreDisplay();
 void resetGameVariables();
 void preparePlayerOneGame();
@@ -174,8 +272,25 @@ void drawFireworksEffect(int x, int y, int intensity);
 void drawSpecialCharacter(int x, int y);
 void clearSpecialCharacter(int x, int y);
 bool shouldShowSpecialCharacter();
-void handleOriginalGameplayLogic(unsigned long currentTime);
-void handleGameplay(GameState currentGameState);
+void enterGameplay(GameState currentGameState);
+void countdownTick();
+void armCharacterTimers();
+void characterTimeout();
+void specialCharacterTimeout();
+void wanderSpecialCharacter();
+void startFeedback(unsigned long now, EntityId hit);
+void feedbackStep();
+void plasmaStep();
+void clearPlasmaBeam();
+void startFrenzyText(unsigned long now);
+void frenzyTextStep();
+void frenzyExpired();
+void rasterizeSprite(uint8_t kind, int x, int y);
+void drawCachedCharacter(uint8_t kind, int x, int y, bool withFlames);
+void reportRenderStats();
+
+// Each character is rasterized once per size and blitted after that
+SpriteCache sprites(tft, rasterizeSprite);
 
 // Unified clear function for any game character
 void clearCharacter(int x, int y, int size) {
@@ -194,18 +309,42 @@ void clearSpecialChicken(int x, int y) {
   clearCharacter(x, y, specialChickenSize);
 }
 
-// Unified tap detection function
-bool isTapInCharacter(int tapX, int tapY, int checkX, int checkY, int size) {
-  int tapMargin = 40;
-  return (tapX >= checkX - tapMargin && 
-          tapX <= checkX + size + tapMargin &&
-          tapY >= checkY - tapMargin && 
-          tapY <= checkY + size + tapMargin);
+// Character placement draws from the same random() as everything else
+int characterRandom(int lo, int hi) {
+  return random(lo, hi);
+}
+
+// Find a clear spot for a new character and add it to the pool
+void spawnCharacter(int kind, int size, EntityId *id) {
+  int x, y;
+  entityPlace(&characters, size, CHARACTER_GAP,
+              size + 20, 40 + size, tft.width() - size - 20, tft.height() - size - 20,
+              characterRandom, &x, &y);
+  *id = entitySpawn(&characters, kind, x, y, size, TAP_MARGIN, 0);
+  telemetry.log(TELEM_SPAWN, kind, *id, TELEM_XY(x, y));
+}
+
+// Clear a character off the screen. In EASY mode it keeps taking taps for
+// a moment after it's gone.
+void despawnCharacter(EntityId *id, unsigned long now) {
+  if (*id == ENTITY_NONE) return;
+  clearCharacter(characters.x[*id], characters.y[*id], characters.size[*id]);
+  telemetry.log(TELEM_DESPAWN, characters.kind[*id], *id);
+  entityDespawn(&characters, *id, now,
+                currentPlayerDifficulty == EASY ? easyGracePeriod : 0);
+  *id = ENTITY_NONE;
 }
 
-// Compatibility function for existing code
-bool isTapInChicken(int tapX, int tapY, int checkX, int checkY, int size) {
-  return isTapInCharacter(tapX, tapY, checkX, checkY, size);
+// Hit or miss, with the time from the finger landing to the decision
+void logTapResult(EntityId hit, uint16_t x, uint16_t y, unsigned long capturedAt) {
+  uint32_t latency = micros() - capturedAt;
+  if (hit == ENTITY_NONE) {
+    telemetry.log(TELEM_MISS, 0, latency, TELEM_XY(x, y));
+  } else {
+    uint8_t kind = characters.kind[hit];
+    if (characters.state[hit] == ENTITY_GHOST) kind |= TELEM_GRACE;
+    telemetry.log(TELEM_HIT, kind, latency, TELEM_XY(x, y));
+  }
 }
 
 void updateScoreDisplay() {
@@ -255,26 +394,20 @@ void updateScoreDisplay() {
     }
   }
   
-  String gamePrefix = (gameVariant == BONK_CHICKEN) ? "BONK! " : 
-                     (gameVariant == BONK_BUNNY) ? "HOP! " : 
-                     (gameVariant == BONK_PATRIOTS) ? "FLAG! " : 
-                     (gameVariant == BONK_BLUEY) ? "TAP! " : "RIDE! ";
-  Serial.print(gamePrefix);
-  Serial.print("Regular Score: ");
-  Serial.print(score);
-  Serial.print(" | Special Score: ");
-  Serial.println(level2Score);
+  telemetry.log(TELEM_SCORE, 0, score, level2Score);
 }
 
 void setup() {
-  Serial.begin(9600);
+  TELEMETRY_PORT.begin(TELEMETRY_BAUD);
+  telemetry.begin();
+  telemetry.log(TELEM_BOOT, 0, TELEMETRY_EVENTS);
   Wire.end();
   delay(100);
   Wire.begin();
   delay(100);
-  tft.begin();
-  tft.setRotation(1);
-  tft.fillScreen(BLACK);
+  panel.begin();
+  panel.setRotation(1);
+  tft.begin(BLACK);
   if (CTP_RST > 0) {
     pinMode(CTP_RST, OUTPUT);
     digitalWrite(CTP_RST, LOW);
@@ -282,46 +415,116 @@ void setup() {
     digitalWrite(CTP_RST, HIGH);
     delay(50);
   }
-  stateStartTime = millis();
+  Wire.setClock(400000);
+  touchInput.begin(CTP_INT, CTP_ADDR, transformTouchCoordinates);
   randomSeed(analogRead(0));
+  timers.begin(millis());
+  timers.observe(profileTimer);
+  enterState(LOAD_SCREEN);
 }
 
 void loop() {
   checkTouchEvents();
-  switch (currentState) {
+
+  // Run every effect whose deadline has come up
+  timers.run(millis());
+
+  // Push this frame's damaged regions to the panel
+  flushFrame();
+
+  // Ship what was logged on the way; never waits for the port
+  telemetry.service(TELEMETRY_PORT);
+
+  // Nothing else can change until a deadline, a frame or a touch
+  sleepUntilNextEvent();
+}
+
+// Switch states and run the new state's setup exactly once. Deadlines
+// belong to the state that armed them, so they are all dropped here.
+void enterState(GameState next) {
+  timers.cancelAll();
+  currentState = next;
+  stateStartTime = millis();
+  telemetry.log(TELEM_STATE, next);
+  switch (next) {
     case LOAD_SCREEN:
-      handleLoadScreen();
+      enterLoadScreen();
       break;
     case GAME_SELECT:
-      handleGameSelection();
+      enterGameSelection();
       break;
     case PLAYER_SELECT:
-      handlePlayerSelection();
+      enterPlayerSelection();
       break;
     case MODE_SELECT_P1:
-      handleModeSelectionP1();
+      enterModeSelectionP1();
       break;
     case PRESS_START_P1:
-      handlePressStartP1();
+      enterPressStartP1();
       break;
     case GAMEPLAY_P1:
-      handleGameplayP1();
+    case GAMEPLAY_P2:
+      enterGameplay(next);
       break;
     case MODE_SELECT_P2:
-      handleModeSelectionP2();
+      enterModeSelectionP2();
       break;
     case PRESS_START_P2:
-      handlePressStartP2();
-      break;
-    case GAMEPLAY_P2:
-      handleGameplayP2();
+      enterPressStartP2();
       break;
     case RESULT_SCREEN:
-      handleResultScreen();
+      enterResultScreen();
       break;
   }
 }
 
+// Sleep until the next deadline, the next compositor frame if anything is
+// waiting to be pushed, or a touch interrupt - whichever comes first
+void sleepUntilNextEvent() {
+  unsigned long now = millis();
+  unsigned long wakeAt = now + IDLE_MAX_SLEEP_MS;
+  unsigned long at = wakeAt;
+
+  if (timers.nextDeadline(at) && (long)(at - wakeAt) < 0) wakeAt = at;
+  if (tft.pendingRegions() > 0 && (long)(tft.nextFlushAt() - wakeAt) < 0) {
+    wakeAt = tft.nextFlushAt();
+  }
+  // A finger on the panel needs the release poll in checkTouchEvents()
+  if (touchInput.activeTouches() > 0) {
+    unsigned long releasePoll = now + TOUCH_RELEASE_POLL_US / 1000;
+    if ((long)(releasePoll - wakeAt) < 0) wakeAt = releasePoll;
+  }
+  // A panel read that failed is retried once its backoff has run out
+  if (touchInput.retryPending()) {
+    int32_t waitUs = (int32_t)(touchInput.retryAtUs() - micros());
+    unsigned long retryAt = now + (waitUs > 0 ? (waitUs + 999) / 1000 : 0);
+    if ((long)(retryAt - wakeAt) < 0) wakeAt = retryAt;
+  }
+
+  while ((long)(millis() - wakeAt) < 0 && !touchInput.pending()) {
+    WAIT_FOR_INTERRUPT();
+  }
+}
+
+// Flush the compositor if a frame is due, or right away with force,
+// bracketing it in telemetry
+void flushFrame(bool force) {
+  uint32_t frames = tft.frameCount();
+  uint32_t bytes = tft.totalBytes();
+  uint32_t startUs = micros();
+  if (force) tft.flush();
+  else tft.flushIfDue(millis());
+  if (tft.frameCount() != frames) {
+    telemetry.logAt(TELEM_FRAME_BEGIN, 0, startUs, 0, 0);
+    telemetry.log(TELEM_FRAME_END, 0, tft.totalBytes() - bytes);
+  }
+}
+
+// Timer wheel observer: one handler record per callback
+void profileTimer(uint8_t id, uint32_t startUs) {
+  telemetry.handler(id, startUs);
+}
+
 void transformTouchCoordinates(uint16_t *x, uint16_t *y) {
   uint16_t tempX = *x;
   uint16_t tempY = *y;
@@ -332,264 +535,254 @@ void transformTouchCoordinates(uint16_t *x, uint16_t *y) {
 }
 
 void checkTouchEvents() {
-  uint8_t data[16];
-  Wire.beginTransmission(CTP_ADDR);
-  Wire.write(0);
-  Wire.endTransmission(false);
-  Wire.requestFrom(CTP_ADDR, 16);
-  
-  if (Wire.available()) {
-    for (int i = 0; i < 16; i++) {
-      data[i] = Wire.read();
+  // The panel read is most of the cost, so it is timed too
+  uint32_t startUs = micros();
+  uint32_t reads = touchInput.panelReads();
+  uint32_t failures = touchInput.readFailures();
+
+  // Only talks to the panel if CTP_INT has fired since the last pass
+  touchInput.poll();
+  
+  bool handled = touchInput.panelReads() != reads;
+  if (touchInput.readFailures() != failures) {
+    telemetry.log(TELEM_TOUCH_FAIL, 0, touchInput.readFailures(), touchInput.reportsAbandoned());
+  }
+  TouchEvent ev;
+  while (touchInput.pop(ev)) {
+    handled = true;
+    telemetry.logAt(TELEM_TOUCH, ev.type | (ev.id << 4), ev.capturedAt,
+                    TELEM_XY(ev.x, ev.y), micros() - ev.capturedAt);
+    
+    // A tap is a finger landing; moves and lifts don't select anything
+    if (ev.type != TOUCH_DOWN) continue;
+    
+    // Debounce per finger so two players can tap at the same time
+    if (ev.capturedAt - lastTapTime[ev.id] > debounceDelay * 1000UL) {
+      lastTapTime[ev.id] = ev.capturedAt;
+      handleTap(ev.x, ev.y, ev.capturedAt);
     }
-    if (data[2] > 0) {
-      uint16_t x = ((data[3] & 0x0F) << 8) | data[4];
-      uint16_t y = ((data[5] & 0x0F) << 8) | data[6];
-      transformTouchCoordinates(&x, &y);
-      Serial.print("Touch at X: ");
-      Serial.print(x);
-      Serial.print(", Y: ");
-      Serial.println(y);
-      unsigned long currentTime = millis();
-      if (currentTime - lastTapTime > debounceDelay) {
-        lastTapTime = currentTime;
-        
-        switch (currentState) {
-          case GAME_SELECT:
-            // Handle game variant selection (3+2 layout for 5 options)
-            // TOP ROW - 3 games
-            if (x > 20 && x < 160 && y > 50 && y < 130) {
-              Serial.println("BONK Chicken selected");
-              gameVariant = BONK_CHICKEN;
-              currentState = PLAYER_SELECT;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 170 && x < 310 && y > 50 && y < 130) {
-              Serial.println("BONK Bunny selected");
-              gameVariant = BONK_BUNNY;
-              currentState = PLAYER_SELECT;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 320 && x < 460 && y > 50 && y < 130) {
-              Serial.println("BONK Patriots selected");
-              gameVariant = BONK_PATRIOTS;
-              currentState = PLAYER_SELECT;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            // BOTTOM ROW - 2 games
-            else if (x > 70 && x < 250 && y > 150 && y < 230) {
-              Serial.println("BONK Bluey selected");
-              gameVariant = BONK_BLUEY;
-              currentState = PLAYER_SELECT;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 260 && x < 440 && y > 150 && y < 230) {
-              Serial.println("BONK Dragons selected - Nolan's game!");
-              gameVariant = BONK_DRAGONS;
-              currentState = PLAYER_SELECT;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case PLAYER_SELECT:
-            // Handle player count selection (1P or 2P)
-            if (x > 50 && x < 230 && y > 120 && y < 220) {
-              Serial.println("1 Player selected");
-              twoPlayerMode = false;
-              currentState = MODE_SELECT_P1;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 250 && x < 430 && y > 120 && y < 220) {
-              Serial.println("2 Players selected");
-              twoPlayerMode = true;
-              currentState = MODE_SELECT_P1;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case MODE_SELECT_P1:
-            // Handle difficulty selection for Player 1
-            if (x > 50 && x < 230 && y > 120 && y < 220) {
-              Serial.println("EASY mode selected for Player 1");
-              p1Difficulty = EASY;
-              currentState = PRESS_START_P1;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 250 && x < 430 && y > 120 && y < 220) {
-              Serial.println("SHRED GNAR mode selected for Player 1");
-              p1Difficulty = SHRED_GNAR;
-              currentState = PRESS_START_P1;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case PRESS_START_P1:
-            // Handle Player 1 press start screen - any tap starts the game
-            if (x > 50 && x < 430 && y > 120 && y < 220) {
-              Serial.println("Player 1 starting game");
-              preparePlayerOneGame();
-              currentState = GAMEPLAY_P1;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case MODE_SELECT_P2:
-            // Handle difficulty selection for Player 2
-            if (x > 50 && x < 230 && y > 120 && y < 220) {
-              Serial.println("EASY mode selected for Player 2");
-              p2Difficulty = EASY;
-              currentState = PRESS_START_P2;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            else if (x > 250 && x < 430 && y > 120 && y < 220) {
-              Serial.println("SHRED GNAR mode selected for Player 2");
-              p2Difficulty = SHRED_GNAR;
-              currentState = PRESS_START_P2;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case PRESS_START_P2:
-            // Handle Player 2 press start screen - any tap starts the game
-            if (x > 50 && x < 430 && y > 120 && y < 220) {
-              Serial.println("Player 2 starting game");
-              preparePlayerTwoGame();
-              currentState = GAMEPLAY_P2;
-              stateStartTime = currentTime;
-              tft.fillScreen(BLACK);
-            }
-            break;
-            
-          case GAMEPLAY_P1:
-          case GAMEPLAY_P2:
-            // Handle gameplay touch events (common for both players)
-            if (chickenVisible && isTapInCharacter(x, y, chickenX, chickenY, currentChickenSize)) {
-              score++;
-              chickenVisible = false;
-              clearCharacter(chickenX, chickenY, currentChickenSize);
-              showFeedback = true;
-              feedbackTime = currentTime;
-              updateScoreDisplay();
-              if (currentPlayerDifficulty == SHRED_GNAR) {
-                bonkStreak++;
-                if (bonkStreak >= 10 && !frenzyMode) {
-                  frenzyMode = true;
-                  frenzyStartTime = currentTime;
-                  currentChickenDuration = currentChickenDuration * 3 / 4;
-                  showFrenzyText = true;
-                  frenzyTextTime = currentTime;
-                }
-                if (currentChickenDuration > minChickenDuration) {
-                  currentChickenDuration -= speedIncreasePerBonk;
-                  currentChickenDuration = max(currentChickenDuration, minChickenDuration);
-                  flameEffectIntensity = map(initialChickenDuration - currentChickenDuration, 
-                                          0, initialChickenDuration - minChickenDuration, 
-                                          0, 5);
-                  showFlameEffect = (flameEffectIntensity > 0);
-                }
-              }
-            }
-            else if (specialChickenVisible && isTapInCharacter(x, y, specialChickenX, specialChickenY, specialChickenSize)) {
-              level2Score++;
-              specialChickenVisible = false;
-              clearCharacter(specialChickenX, specialChickenY, specialChickenSize);
-              showFeedback = true;
-              feedbackTime = currentTime;
-              updateScoreDisplay();
-              if (currentPlayerDifficulty == SHRED_GNAR) {
-                bonkStreak++;
-                if (bonkStreak >= 10 && !frenzyMode) {
-                  frenzyMode = true;
-                  frenzyStartTime = currentTime;
-                  currentChickenDuration = currentChickenDuration * 3 / 4;
-                  showFrenzyText = true;
-                  frenzyTextTime = currentTime;
-                }
-                // Show appropriate special effects based on game variant
-                if (gameVariant == BONK_PATRIOTS) {
-                  // Fireworks effect for Patriots
-                  drawFireworksEffect(specialChickenX, specialChickenY, 5);
-                } else if (gameVariant == BONK_BLUEY) {
-                  // Confetti effect for Bluey balloon pop
-                  drawConfettiEffect(specialChickenX, specialChickenY);
-                } else {
-                  // Explosion effects for Chicken/Bunny
-                  for (int i = 0; i < 5; i++) {
-                    int explodeX = specialChickenX + random(-20, 20);
-                    int explodeY = specialChickenY + random(-20, 20);
-                    uint16_t explodeColor = random(3) == 0 ? RED : (random(2) == 0 ? ORANGE : YELLOW);
-                    tft.fillCircle(explodeX, explodeY, random(5, 15), explodeColor);
-                    delay(20);
-                  }
-                }
-                
-                // Store the position info for proper clearing later
-                int textX = specialChickenX - 20;
-                int textY = specialChickenY - 20;
-                int textWidth = 100;
-                int textHeight = 40;
-                
-                // Show appropriate text based on game variant
-                tft.setTextColor(YELLOW);
-                tft.setTextSize(4);
-                tft.setCursor(textX, textY);
-                if (gameVariant == BONK_PATRIOTS) {
-                  tft.print("USA!");
-                  textWidth = 80; // USA! is shorter than GNAR!
-                } else if (gameVariant == BONK_BLUEY) {
-                  tft.print("WOW!");
-                  textWidth = 80; // WOW! is short like USA!
-                } else {
-                  tft.print("GNAR!");
-                }
-                
-                // Set up a timer to clear this text after a brief delay
-                showFrenzyText = true;
-                frenzyTextTime = currentTime;
-                
-                // Store the area to clear in global variables
-                lastSpecialChickenX = textX;
-                lastSpecialChickenY = textY;
-                specialChickenSize = max(textWidth, textHeight);
-                
-                clearCharacter(specialChickenX, specialChickenY, specialChickenSize);
-              }
-            }
-            else if (currentPlayerDifficulty == EASY && !chickenVisible && 
-                   (currentTime - chickenDisappearTime < afterDisappearGracePeriod) && 
-                   isTapInCharacter(x, y, lastChickenX, lastChickenY, currentChickenSize)) {
-              score++;
-              showFeedback = true;
-              feedbackTime = currentTime;
-              updateScoreDisplay();
-            }
-            else if (currentPlayerDifficulty == EASY && !specialChickenVisible && 
-                   (currentTime - specialChickenDisappearTime < afterDisappearGracePeriod) && 
-                   isTapInCharacter(x, y, lastSpecialChickenX, lastSpecialChickenY, specialChickenSize)) {
-              level2Score++;
-              showFeedback = true;
-              feedbackTime = currentTime;
-              updateScoreDisplay();
+  }
+  if (handled) telemetry.handler(HANDLER_TOUCH, startUs);
+}
+
+// Act on a single tap at screen position (x, y). capturedAt is the
+// micros() of the touch interrupt, for tap-to-hit latency.
+void handleTap(uint16_t x, uint16_t y, unsigned long capturedAt) {
+  unsigned long currentTime = millis();
+  EntityId hit;
+  
+  switch (currentState) {
+    case GAME_SELECT:
+      // Handle game variant selection (3+2 layout for 5 options)
+      // TOP ROW - 3 games
+      if (x > 20 && x < 160 && y > 50 && y < 130) {
+        telemetry.log(TELEM_MENU, currentState, BONK_CHICKEN);
+        gameVariant = BONK_CHICKEN;
+        enterState(PLAYER_SELECT);
+      }
+      else if (x > 170 && x < 310 && y > 50 && y < 130) {
+        telemetry.log(TELEM_MENU, currentState, BONK_BUNNY);
+        gameVariant = BONK_BUNNY;
+        enterState(PLAYER_SELECT);
+      }
+      else if (x > 320 && x < 460 && y > 50 && y < 130) {
+        telemetry.log(TELEM_MENU, currentState, BONK_PATRIOTS);
+        gameVariant = BONK_PATRIOTS;
+        enterState(PLAYER_SELECT);
+      }
+      // BOTTOM ROW - 2 games
+      else if (x > 70 && x < 250 && y > 150 && y < 230) {
+        telemetry.log(TELEM_MENU, currentState, BONK_BLUEY);
+        gameVariant = BONK_BLUEY;
+        enterState(PLAYER_SELECT);
+      }
+      else if (x > 260 && x < 440 && y > 150 && y < 230) {
+        telemetry.log(TELEM_MENU, currentState, BONK_DRAGONS);
+        gameVariant = BONK_DRAGONS;
+        enterState(PLAYER_SELECT);
+      }
+      break;
+      
+    case PLAYER_SELECT:
+      // Handle player count selection (1P or 2P)
+      if (x > 50 && x < 230 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, 1);
+        twoPlayerMode = false;
+        enterState(MODE_SELECT_P1);
+      }
+      else if (x > 250 && x < 430 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, 2);
+        twoPlayerMode = true;
+        enterState(MODE_SELECT_P1);
+      }
+      break;
+      
+    case MODE_SELECT_P1:
+      // Handle difficulty selection for Player 1
+      if (x > 50 && x < 230 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, EASY);
+        p1Difficulty = EASY;
+        enterState(PRESS_START_P1);
+      }
+      else if (x > 250 && x < 430 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, SHRED_GNAR);
+        p1Difficulty = SHRED_GNAR;
+        enterState(PRESS_START_P1);
+      }
+      break;
+      
+    case PRESS_START_P1:
+      // Handle Player 1 press start screen - any tap starts the game
+      if (x > 50 && x < 430 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, 0);
+        preparePlayerOneGame();
+        enterState(GAMEPLAY_P1);
+      }
+      break;
+      
+    case MODE_SELECT_P2:
+      // Handle difficulty selection for Player 2
+      if (x > 50 && x < 230 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, EASY);
+        p2Difficulty = EASY;
+        enterState(PRESS_START_P2);
+      }
+      else if (x > 250 && x < 430 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, SHRED_GNAR);
+        p2Difficulty = SHRED_GNAR;
+        enterState(PRESS_START_P2);
+      }
+      break;
+      
+    case PRESS_START_P2:
+      // Handle Player 2 press start screen - any tap starts the game
+      if (x > 50 && x < 430 && y > 120 && y < 220) {
+        telemetry.log(TELEM_MENU, currentState, 0);
+        preparePlayerTwoGame();
+        enterState(GAMEPLAY_P2);
+      }
+      break;
+      
+    case GAMEPLAY_P1:
+    case GAMEPLAY_P2:
+      // Handle gameplay touch events (common for both players)
+      hit = entityHit(&characters, x, y, currentTime);
+      logTapResult(hit, x, y, capturedAt);
+      if (hit == ENTITY_NONE) {
+        // Missed everything
+      }
+      else if (characters.state[hit] == ENTITY_GHOST) {
+        // EASY mode grace: the character just left, count it anyway
+        if (characters.kind[hit] == CHARACTER_SPECIAL) {
+          level2Score++;
+        } else {
+          score++;
+        }
+        startFeedback(currentTime, hit);
+        updateScoreDisplay();
+        entityRelease(&characters, hit);
+      }
+      else if (hit == chickenId) {
+        score++;
+        clearCharacter(characters.x[hit], characters.y[hit], characters.size[hit]);
+        startFeedback(currentTime, hit);
+        entityRelease(&characters, hit);
+        chickenId = ENTITY_NONE;
+        updateScoreDisplay();
+        if (currentPlayerDifficulty == SHRED_GNAR) {
+          bonkStreak++;
+          if (bonkStreak >= 10 && !frenzyMode) {
+            frenzyMode = true;
+            frenzyStartTime = currentTime;
+            currentChickenDuration = currentChickenDuration * 3 / 4;
+            timers.schedule(TIMER_FRENZY, frenzyStartTime + frenzyDuration + 1, frenzyExpired);
+            startFrenzyText(currentTime);
+          }
+          if (currentChickenDuration > minChickenDuration) {
+            currentChickenDuration -= speedIncreasePerBonk;
+            currentChickenDuration = max(currentChickenDuration, minChickenDuration);
+            flameEffectIntensity = map(initialChickenDuration - currentChickenDuration, 
+                                    0, initialChickenDuration - minChickenDuration, 
+                                    0, 5);
+            showFlameEffect = (flameEffectIntensity > 0);
+          }
+        }
+      }
+      else if (hit == specialChickenId) {
+        int hitX = characters.x[hit];
+        int hitY = characters.y[hit];
+        level2Score++;
+        clearCharacter(hitX, hitY, characters.size[hit]);
+        startFeedback(currentTime, hit);
+        entityRelease(&characters, hit);
+        specialChickenId = ENTITY_NONE;
+        updateScoreDisplay();
+        if (currentPlayerDifficulty == SHRED_GNAR) {
+          bonkStreak++;
+          if (bonkStreak >= 10 && !frenzyMode) {
+            frenzyMode = true;
+            frenzyStartTime = currentTime;
+            currentChickenDuration = currentChickenDuration * 3 / 4;
+            timers.schedule(TIMER_FRENZY, frenzyStartTime + frenzyDuration + 1, frenzyExpired);
+            startFrenzyText(currentTime);
+          }
+          // Show appropriate special effects based on game variant
+          if (gameVariant == BONK_PATRIOTS) {
+            // Fireworks effect for Patriots
+            drawFireworksEffect(hitX, hitY, 5);
+          } else if (gameVariant == BONK_BLUEY) {
+            // Confetti effect for Bluey balloon pop
+            drawConfettiEffect(hitX, hitY);
+          } else {
+            // Explosion effects for Chicken/Bunny
+            for (int i = 0; i < 5; i++) {
+              int explodeX = hitX + random(-20, 20);
+              int explodeY = hitY + random(-20, 20);
+              uint16_t explodeColor = random(3) == 0 ? RED : (random(2) == 0 ? ORANGE : YELLOW);
+              tft.fillCircle(explodeX, explodeY, random(5, 15), explodeColor);
+              flushFrame(true);
+              delay(20);
             }
-            break;
-            
-          default:
-            break;
+          }
+          
+          // Store the position info for proper clearing later
+          int textX = hitX - 20;
+          int textY = hitY - 20;
+          int textWidth = 100;
+          int textHeight = 40;
+          
+          // Show appropriate text based on game variant
+          tft.setTextColor(YELLOW);
+          tft.setTextSize(4);
+          tft.setCursor(textX, textY);
+          if (gameVariant == BONK_PATRIOTS) {
+            tft.print("USA!");
+            textWidth = 80; // USA! is shorter than GNAR!
+          } else if (gameVariant == BONK_BLUEY) {
+            tft.print("WOW!");
+            textWidth = 80; // WOW! is short like USA!
+          } else {
+            tft.print("GNAR!");
+          }
+          
+          // Set up a timer to clear this text after a brief delay
+          startFrenzyText(currentTime);
+          
+          // Store the area to clear in global variables
+          specialTextX = textX;
+          specialTextY = textY;
+          specialChickenSize = max(textWidth, textHeight);
+          
+          clearCharacter(hitX, hitY, specialChickenSize);
         }
       }
-    }
+      
+      // SHRED GNAR hits speed the characters up, so move their deadlines
+      armCharacterTimers();
+      break;
+      
+    default:
+      break;
   }
 }
 
@@ -600,8 +793,9 @@ void resetGameVariables() {
   lastChickenTime = 0;
   lastSpecialChickenTime = 0;
   lastTimerUpdate = 0;
-  chickenVisible = false;
-  specialChickenVisible = false;
+  entityInit(&characters, tft.width(), tft.height(), MAX_CHARACTER_SIZE + 2 * TAP_MARGIN);
+  chickenId = ENTITY_NONE;
+  specialChickenId = ENTITY_NONE;
   showFeedback = false;
   showSpecialChicken = false;
   showFrenzyText = false;
@@ -610,7 +804,6 @@ void resetGameVariables() {
   showFlameEffect = false;
   bonkStreak = 0;
   frenzyMode = false;
-  afterDisappearGracePeriod = (currentPlayerDifficulty == EASY) ? 800 : 0;
 }
 
 // Prepare the game for Player 1
@@ -641,397 +834,357 @@ void preparePlayerTwoGame() {
   level2Score = 0;
 }
 
-void handleLoadScreen() {
-  unsigned long currentTime = millis();
-  unsigned long elapsedTime = currentTime - stateStartTime;
-  if (loadScreenPhase == 0 && elapsedTime < 2000) {
-    if (elapsedTime < 100) {
-      tft.fillScreen(BLACK);
-      tft.setTextColor(WHITE);
-      tft.setTextSize(6);
-      tft.setCursor(140, 120);
-      tft.println("BONK");
-    }
-  }
-  else if (loadScreenPhase <= 1 && elapsedTime >= 2000 && elapsedTime < 4000) {
-    if (loadScreenPhase == 0) {
-      loadScreenPhase = 1;
-      tft.fillScreen(BLACK);
-      tft.setTextColor(WHITE);
-      tft.setTextSize(2);
-      tft.setCursor(70, 140);
-      tft.println("Created 2025 by Trent Von Holten");
-    }
+// Splash screens: BONK, credits, rules, then game selection
+void enterLoadScreen() {
+  loadScreenPhase = 0;
+  tft.fillScreen(BLACK);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(6);
+  tft.setCursor(140, 120);
+  tft.println("BONK");
+  timers.schedule(TIMER_STATE, stateStartTime + 2000, advanceLoadScreen);
+}
+
+void advanceLoadScreen() {
+  if (loadScreenPhase == 0) {
+    loadScreenPhase = 1;
+    tft.fillScreen(BLACK);
+    tft.setTextColor(WHITE);
+    tft.setTextSize(2);
+    tft.setCursor(70, 140);
+    tft.println("Created 2025 by Trent Von Holten");
+    timers.schedule(TIMER_STATE, stateStartTime + 4000, advanceLoadScreen);
   }
-  else if (loadScreenPhase <= 2 && elapsedTime >= 4000 && elapsedTime < 7000) {
-    if (loadScreenPhase == 1) {
-      loadScreenPhase = 2;
-      tft.fillScreen(BLACK);
-      tft.setTextColor(WHITE);
-      tft.setTextSize(3);
-      tft.setCursor(50, 100);
-      tft.println("RULES: BONK the");
-      tft.setCursor(50, 140);
-      tft.println("character... if you can");
-    }
+  else if (loadScreenPhase == 1) {
+    loadScreenPhase = 2;
+    tft.fillScreen(BLACK);
+    tft.setTextColor(WHITE);
+    tft.setTextSize(3);
+    tft.setCursor(50, 100);
+    tft.println("RULES: BONK the");
+    tft.setCursor(50, 140);
+    tft.println("character... if you can");
+    timers.schedule(TIMER_STATE, stateStartTime + 7000, advanceLoadScreen);
   }
-  else if (elapsedTime >= 7000) {
+  else {
     // After splash screens, go to game variant selection
-    currentState = GAME_SELECT;
-    stateStartTime = currentTime;
-    tft.fillScreen(BLACK);
-    Serial.println("Switching to GAME_SELECT");
+    enterState(GAME_SELECT);
   }
 }
 
 // Updated function to handle FOUR game variant options in 2x2 grid
-void handleGameSelection() {
-  unsigned long currentTime = millis();
+void enterGameSelection() {
+  tft.fillScreen(BLACK);
   
-  // Draw the screen once when entering this state or refresh periodically
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    
-    Serial.println("Drawing GAME SELECT screen");
-    tft.fillScreen(BLACK);
-    
-    // Title
-    tft.setTextColor(WHITE);
-    tft.setTextSize(3);
-    tft.setCursor(120, 10);
-    tft.println("SELECT GAME");
-    
-    // NEW LAYOUT: 3 games on top row, 2 games on bottom row
-    int topWidth = 140;   // Narrower buttons for 3 across
-    int topHeight = 80;   // Slightly shorter
-    int bottomWidth = 180; // Wider for 2 across
-    int bottomHeight = 80;
-    
-    // TOP ROW - 3 games
-    // BONK Chicken (top left)
-    tft.drawRect(20, 50, topWidth, topHeight, YELLOW);
-    tft.drawRect(21, 51, topWidth-2, topHeight-2, YELLOW);
-    tft.fillRect(22, 52, topWidth-4, topHeight-4, RED);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(50, 70);
-    tft.println("BONK");
-    tft.setCursor(40, 95);
-    tft.println("CHICKEN");
-    
-    // BONK Bunny (top middle)
-    tft.drawRect(170, 50, topWidth, topHeight, WHITE);
-    tft.drawRect(171, 51, topWidth-2, topHeight-2, WHITE);
-    tft.fillRect(172, 52, topWidth-4, topHeight-4, PURPLE);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(200, 70);
-    tft.println("BONK");
-    tft.setCursor(195, 95);
-    tft.println("BUNNY");
-    
-    // BONK Patriots (top right)
-    tft.drawRect(320, 50, topWidth, topHeight, BLUE);
-    tft.drawRect(321, 51, topWidth-2, topHeight-2, BLUE);
-    tft.fillRect(322, 52, topWidth-4, topHeight-4, RED);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(350, 70);
-    tft.println("BONK");
-    tft.setCursor(335, 95);
-    tft.println("PATRIOTS");
-    
-    // BOTTOM ROW - 2 games
-    // BONK Bluey (bottom left)
-    tft.drawRect(70, 150, bottomWidth, bottomHeight, CYAN);
-    tft.drawRect(71, 151, bottomWidth-2, bottomHeight-2, CYAN);
-    tft.fillRect(72, 152, bottomWidth-4, bottomHeight-4, BLUE);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(130, 170);
-    tft.println("BONK");
-    tft.setCursor(125, 195);
-    tft.println("BLUEY");
-    
-    // BONK Dragons (bottom right) - NOLAN'S!
-    tft.drawRect(260, 150, bottomWidth, bottomHeight, PLASMA_BLUE);
-    tft.drawRect(261, 151, bottomWidth-2, bottomHeight-2, PLASMA_BLUE);
-    tft.fillRect(262, 152, bottomWidth-4, bottomHeight-4, DARK_GRAY);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(320, 170);
-    tft.println("BONK");
-    tft.setCursor(305, 195);
-    tft.println("DRAGONS");
-    
-    // Small character previews
-    tft.setTextSize(1);
-    tft.setCursor(65, 120);
-    tft.setTextColor(YELLOW);
-    tft.print("Classic!");
-    
-    tft.setCursor(215, 120);
-    tft.setTextColor(MAGENTA);
-    tft.print("Easter!");
-    
-    tft.setCursor(355, 120);
-    tft.setTextColor(RED);
-    tft.print("USA!");
-    
-    tft.setCursor(125, 220);
-    tft.setTextColor(ORANGE);
-    tft.print("Bluey!");
-    
-    tft.setCursor(310, 220);
-    tft.setTextColor(GREEN);
-    tft.print("Dragons!");
-  }
+  // Title
+  tft.setTextColor(WHITE);
+  tft.setTextSize(3);
+  tft.setCursor(120, 10);
+  tft.println("SELECT GAME");
+  
+  // NEW LAYOUT: 3 games on top row, 2 games on bottom row
+  int topWidth = 140;   // Narrower buttons for 3 across
+  int topHeight = 80;   // Slightly shorter
+  int bottomWidth = 180; // Wider for 2 across
+  int bottomHeight = 80;
+  
+  // TOP ROW - 3 games
+  // BONK Chicken (top left)
+  tft.drawRect(20, 50, topWidth, topHeight, YELLOW);
+  tft.drawRect(21, 51, topWidth-2, topHeight-2, YELLOW);
+  tft.fillRect(22, 52, topWidth-4, topHeight-4, RED);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(50, 70);
+  tft.println("BONK");
+  tft.setCursor(40, 95);
+  tft.println("CHICKEN");
+  
+  // BONK Bunny (top middle)
+  tft.drawRect(170, 50, topWidth, topHeight, WHITE);
+  tft.drawRect(171, 51, topWidth-2, topHeight-2, WHITE);
+  tft.fillRect(172, 52, topWidth-4, topHeight-4, PURPLE);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(200, 70);
+  tft.println("BONK");
+  tft.setCursor(195, 95);
+  tft.println("BUNNY");
+  
+  // BONK Patriots (top right)
+  tft.drawRect(320, 50, topWidth, topHeight, BLUE);
+  tft.drawRect(321, 51, topWidth-2, topHeight-2, BLUE);
+  tft.fillRect(322, 52, topWidth-4, topHeight-4, RED);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(350, 70);
+  tft.println("BONK");
+  tft.setCursor(335, 95);
+  tft.println("PATRIOTS");
+  
+  // BOTTOM ROW - 2 games
+  // BONK Bluey (bottom left)
+  tft.drawRect(70, 150, bottomWidth, bottomHeight, CYAN);
+  tft.drawRect(71, 151, bottomWidth-2, bottomHeight-2, CYAN);
+  tft.fillRect(72, 152, bottomWidth-4, bottomHeight-4, BLUE);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(130, 170);
+  tft.println("BONK");
+  tft.setCursor(125, 195);
+  tft.println("BLUEY");
+  
+  // BONK Dragons (bottom right) - NOLAN'S!
+  tft.drawRect(260, 150, bottomWidth, bottomHeight, PLASMA_BLUE);
+  tft.drawRect(261, 151, bottomWidth-2, bottomHeight-2, PLASMA_BLUE);
+  tft.fillRect(262, 152, bottomWidth-4, bottomHeight-4, DARK_GRAY);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(320, 170);
+  tft.println("BONK");
+  tft.setCursor(305, 195);
+  tft.println("DRAGONS");
+  
+  // Small character previews
+  tft.setTextSize(1);
+  tft.setCursor(65, 120);
+  tft.setTextColor(YELLOW);
+  tft.print("Classic!");
+  
+  tft.setCursor(215, 120);
+  tft.setTextColor(MAGENTA);
+  tft.print("Easter!");
+  
+  tft.setCursor(355, 120);
+  tft.setTextColor(RED);
+  tft.print("USA!");
+  
+  tft.setCursor(125, 220);
+  tft.setTextColor(ORANGE);
+  tft.print("Bluey!");
+  
+  tft.setCursor(310, 220);
+  tft.setTextColor(GREEN);
+  tft.print("Dragons!");
 }
 
 // New function to handle player count selection
-void handlePlayerSelection() {
-  unsigned long currentTime = millis();
+void enterPlayerSelection() {
+  tft.fillScreen(BLACK);
   
-  // Draw the screen once when entering this state or refresh periodically
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    
-    Serial.println("Drawing PLAYER SELECT screen");
-    tft.fillScreen(BLACK);
-    
-    // Title
-    tft.setTextColor(WHITE);
-    tft.setTextSize(4);
-    tft.setCursor(60, 40);
-    tft.println("SELECT PLAYERS");
-    
-    // 1 Player option
-    tft.drawRect(50, 120, 180, 100, GREEN);
-    tft.drawRect(51, 121, 178, 98, GREEN);
-    tft.fillRect(52, 122, 176, 96, BLUE);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(4);
-    tft.setCursor(120, 160);
-    tft.println("1P");
-    
-    // 2 Player option
-    tft.drawRect(250, 120, 180, 100, RED);
-    tft.drawRect(251, 121, 178, 98, RED);
-    tft.fillRect(252, 122, 176, 96, MAGENTA);
-    tft.setTextColor(YELLOW);
-    tft.setTextSize(4);
-    tft.setCursor(320, 160);
-    tft.println("2P");
-    
-    // Descriptions
-    tft.setTextSize(1);
-    tft.setTextColor(GREEN);
-    tft.setCursor(85, 230);
-    tft.println("Single Player Mode");
-    
-    tft.setTextColor(WHITE);
-    tft.setCursor(270, 230);
-    tft.println("Play with a Friend!");
-  }
+  // Title
+  tft.setTextColor(WHITE);
+  tft.setTextSize(4);
+  tft.setCursor(60, 40);
+  tft.println("SELECT PLAYERS");
+  
+  // 1 Player option
+  tft.drawRect(50, 120, 180, 100, GREEN);
+  tft.drawRect(51, 121, 178, 98, GREEN);
+  tft.fillRect(52, 122, 176, 96, BLUE);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(4);
+  tft.setCursor(120, 160);
+  tft.println("1P");
+  
+  // 2 Player option
+  tft.drawRect(250, 120, 180, 100, RED);
+  tft.drawRect(251, 121, 178, 98, RED);
+  tft.fillRect(252, 122, 176, 96, MAGENTA);
+  tft.setTextColor(YELLOW);
+  tft.setTextSize(4);
+  tft.setCursor(320, 160);
+  tft.println("2P");
+  
+  // Descriptions
+  tft.setTextSize(1);
+  tft.setTextColor(GREEN);
+  tft.setCursor(85, 230);
+  tft.println("Single Player Mode");
+  
+  tft.setTextColor(WHITE);
+  tft.setCursor(270, 230);
+  tft.println("Play with a Friend!");
 }
 
 // Player 1 mode selection
-void handleModeSelectionP1() {
-  unsigned long currentTime = millis();
-  // Draw the screen once when entering this state or every 5 seconds as a fallback
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    Serial.println("Drawing MODE SELECT screen for Player 1");
-    tft.fillScreen(BLACK);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(4);
-    tft.setCursor(50, 40);
-    tft.println("PLAYER 1 MODE");
-    tft.drawRect(50, 120, 180, 100, GREEN);
-    tft.drawRect(51, 121, 178, 98, GREEN);
-    tft.fillRect(52, 122, 176, 96, BLUE);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(3);
-    tft.setCursor(105, 160);
-    tft.println("EASY");
-    tft.drawRect(250, 120, 180, 100, RED);
-    tft.drawRect(251, 121, 178, 98, RED);
-    tft.fillRect(252, 122, 176, 96, MAGENTA);
-    tft.setTextColor(YELLOW);
-    tft.setTextSize(2);
-    tft.setCursor(270, 160);
-    tft.println("SHRED GNAR");
-    tft.setTextSize(1);
-    tft.setTextColor(GREEN);
-    tft.setCursor(60, 230);
-    tft.println("Kid-friendly");
-    tft.setTextColor(WHITE);
-    tft.setCursor(270, 230);
-    tft.println("Gets faster. CHALLENGE!");
-  }
+void enterModeSelectionP1() {
+  tft.fillScreen(BLACK);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(4);
+  tft.setCursor(50, 40);
+  tft.println("PLAYER 1 MODE");
+  tft.drawRect(50, 120, 180, 100, GREEN);
+  tft.drawRect(51, 121, 178, 98, GREEN);
+  tft.fillRect(52, 122, 176, 96, BLUE);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(3);
+  tft.setCursor(105, 160);
+  tft.println("EASY");
+  tft.drawRect(250, 120, 180, 100, RED);
+  tft.drawRect(251, 121, 178, 98, RED);
+  tft.fillRect(252, 122, 176, 96, MAGENTA);
+  tft.setTextColor(YELLOW);
+  tft.setTextSize(2);
+  tft.setCursor(270, 160);
+  tft.println("SHRED GNAR");
+  tft.setTextSize(1);
+  tft.setTextColor(GREEN);
+  tft.setCursor(60, 230);
+  tft.println("Kid-friendly");
+  tft.setTextColor(WHITE);
+  tft.setCursor(270, 230);
+  tft.println("Gets faster. CHALLENGE!");
 }
 
 // Player 2 mode selection
-void handleModeSelectionP2() {
-  unsigned long currentTime = millis();
-  // Draw the screen once when entering this state or every 5 seconds as a fallback
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    Serial.println("Drawing MODE SELECT screen for Player 2");
-    tft.fillScreen(BLACK);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(4);
-    tft.setCursor(50, 40);
-    tft.println("PLAYER 2 MODE");
-    tft.drawRect(50, 120, 180, 100, GREEN);
-    tft.drawRect(51, 121, 178, 98, GREEN);
-    tft.fillRect(52, 122, 176, 96, BLUE);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(3);
-    tft.setCursor(105, 160);
-    tft.println("EASY");
-    tft.drawRect(250, 120, 180, 100, RED);
-    tft.drawRect(251, 121, 178, 98, RED);
-    tft.fillRect(252, 122, 176, 96, MAGENTA);
-    tft.setTextColor(YELLOW);
-    tft.setTextSize(2);
-    tft.setCursor(270, 160);
-    tft.println("SHRED GNAR");
-    tft.setTextSize(1);
-    tft.setTextColor(GREEN);
-    tft.setCursor(60, 230);
-    tft.println("Kid-friendly");
-    tft.setTextColor(WHITE);
-    tft.setCursor(270, 230);
-    tft.println("Gets faster. CHALLENGE!");
-  }
+void enterModeSelectionP2() {
+  tft.fillScreen(BLACK);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(4);
+  tft.setCursor(50, 40);
+  tft.println("PLAYER 2 MODE");
+  tft.drawRect(50, 120, 180, 100, GREEN);
+  tft.drawRect(51, 121, 178, 98, GREEN);
+  tft.fillRect(52, 122, 176, 96, BLUE);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(3);
+  tft.setCursor(105, 160);
+  tft.println("EASY");
+  tft.drawRect(250, 120, 180, 100, RED);
+  tft.drawRect(251, 121, 178, 98, RED);
+  tft.fillRect(252, 122, 176, 96, MAGENTA);
+  tft.setTextColor(YELLOW);
+  tft.setTextSize(2);
+  tft.setCursor(270, 160);
+  tft.println("SHRED GNAR");
+  tft.setTextSize(1);
+  tft.setTextColor(GREEN);
+  tft.setCursor(60, 230);
+  tft.println("Kid-friendly");
+  tft.setTextColor(WHITE);
+  tft.setCursor(270, 230);
+  tft.println("Gets faster. CHALLENGE!");
 }
 
 // Player 1 press start screen
-void handlePressStartP1() {
-  unsigned long currentTime = millis();
-  // Draw the screen once when entering this state or refresh periodically
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    
-    Serial.println("Drawing PRESS START screen for Player 1");
-    tft.fillScreen(BLACK);
-    
-    // Title
+void enterPressStartP1() {
+  tft.fillScreen(BLACK);
+  
+  // Title
+  tft.setTextColor(GREEN);
+  tft.setTextSize(4);
+  tft.setCursor(120, 40);
+  tft.println("PLAYER 1");
+  
+  // Game variant and difficulty
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(100, 90);
+  tft.print("Game: BONK ");
+  String variantName = (gameVariant == BONK_CHICKEN) ? "CHICKEN" : 
+                      (gameVariant == BONK_BUNNY) ? "BUNNY" : 
+                      (gameVariant == BONK_PATRIOTS) ? "PATRIOTS" : 
+                      (gameVariant == BONK_BLUEY) ? "BLUEY" : "DRAGONS";
+  tft.print(variantName);
+  
+  tft.setCursor(100, 120);
+  tft.print("Mode: ");
+  if (p1Difficulty == EASY) {
     tft.setTextColor(GREEN);
-    tft.setTextSize(4);
-    tft.setCursor(120, 40);
-    tft.println("PLAYER 1");
-    
-    // Game variant and difficulty
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(100, 90);
-    tft.print("Game: BONK ");
-    String variantName = (gameVariant == BONK_CHICKEN) ? "CHICKEN" : 
-                        (gameVariant == BONK_BUNNY) ? "BUNNY" : 
-                        (gameVariant == BONK_PATRIOTS) ? "PATRIOTS" : 
-                        (gameVariant == BONK_BLUEY) ? "BLUEY" : "DRAGONS";
-    tft.print(variantName);
-    
-    tft.setCursor(100, 120);
-    tft.print("Mode: ");
-    if (p1Difficulty == EASY) {
-      tft.setTextColor(GREEN);
-      tft.print("EASY");
-    } else {
-      tft.setTextColor(RED);
-      tft.print("SHRED GNAR");
-    }
-    
-    // Press start button
-    tft.drawRect(120, 160, 240, 80, BLUE);
-    tft.drawRect(121, 161, 238, 78, BLUE);
-    tft.fillRect(122, 162, 236, 76, GREEN);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(3);
-    tft.setCursor(140, 190);
-    tft.println("PRESS START");
-    
-    // Flashing effect
-    if ((currentTime / 500) % 2 == 0) {
-      tft.setTextColor(YELLOW);
-      tft.setTextSize(2);
-      tft.setCursor(150, 250);
-      tft.println("TAP TO BEGIN!");
-    }
+    tft.print("EASY");
+  } else {
+    tft.setTextColor(RED);
+    tft.print("SHRED GNAR");
   }
+  
+  // Press start button
+  tft.drawRect(120, 160, 240, 80, BLUE);
+  tft.drawRect(121, 161, 238, 78, BLUE);
+  tft.fillRect(122, 162, 236, 76, GREEN);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(3);
+  tft.setCursor(140, 190);
+  tft.println("PRESS START");
+  
+  // Flashing effect
+  blinkStartPrompt();
 }
 
 // Player 2 press start screen
-void handlePressStartP2() {
-  unsigned long currentTime = millis();
-  // Draw the screen once when entering this state or refresh periodically
-  if ((currentTime - stateStartTime) < 100 || 
-      ((currentTime - stateStartTime) % 5000 >= 0 && (currentTime - stateStartTime) % 5000 < 100)) {
-    
-    Serial.println("Drawing PRESS START screen for Player 2");
-    tft.fillScreen(BLACK);
-    
-    // Player 1 results
-    tft.setTextColor(BLUE);
-    tft.setTextSize(2);
-    tft.setCursor(50, 10);
-    tft.println("Player 1 Score:");
-    
-    tft.setTextColor(WHITE);
-    tft.setCursor(70, 40);
-    String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
-                       (gameVariant == BONK_BUNNY) ? "HOPS: " : 
-                       (gameVariant == BONK_PATRIOTS) ? "FLAGS: " : 
-                       (gameVariant == BONK_BLUEY) ? "TAPS: " : "RIDES: ";
-    tft.print(scoreLabel);
-    tft.print(p1Score);
-    
-    tft.setCursor(70, 60);
-    String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
-                         (gameVariant == BONK_BUNNY) ? "EGGS: " : 
-                         (gameVariant == BONK_PATRIOTS) ? "STARS: " : 
-                         (gameVariant == BONK_BLUEY) ? "BALLOONS: " : "FISH: ";
-    tft.print(specialLabel);
-    tft.print(p1SpecialScore);
-    
-    // Title
+void enterPressStartP2() {
+  tft.fillScreen(BLACK);
+  
+  // Player 1 results
+  tft.setTextColor(BLUE);
+  tft.setTextSize(2);
+  tft.setCursor(50, 10);
+  tft.println("Player 1 Score:");
+  
+  tft.setTextColor(WHITE);
+  tft.setCursor(70, 40);
+  String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
+                     (gameVariant == BONK_BUNNY) ? "HOPS: " : 
+                     (gameVariant == BONK_PATRIOTS) ? "FLAGS: " : 
+                     (gameVariant == BONK_BLUEY) ? "TAPS: " : "RIDES: ";
+  tft.print(scoreLabel);
+  tft.print(p1Score);
+  
+  tft.setCursor(70, 60);
+  String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
+                       (gameVariant == BONK_BUNNY) ? "EGGS: " : 
+                       (gameVariant == BONK_PATRIOTS) ? "STARS: " : 
+                       (gameVariant == BONK_BLUEY) ? "BALLOONS: " : "FISH: ";
+  tft.print(specialLabel);
+  tft.print(p1SpecialScore);
+  
+  // Title
+  tft.setTextColor(RED);
+  tft.setTextSize(4);
+  tft.setCursor(120, 90);
+  tft.println("PLAYER 2");
+  
+  // Game variant and difficulty
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(100, 140);
+  tft.print("Mode: ");
+  if (p2Difficulty == EASY) {
+    tft.setTextColor(GREEN);
+    tft.print("EASY");
+  } else {
     tft.setTextColor(RED);
-    tft.setTextSize(4);
-    tft.setCursor(120, 90);
-    tft.println("PLAYER 2");
-    
-    // Game variant and difficulty
-    tft.setTextColor(WHITE);
+    tft.print("SHRED GNAR");
+  }
+  
+  // Press start button
+  tft.drawRect(120, 180, 240, 80, BLUE);
+  tft.drawRect(121, 181, 238, 78, BLUE);
+  tft.fillRect(122, 182, 236, 76, RED);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(3);
+  tft.setCursor(140, 210);
+  tft.println("PRESS START");
+  
+  // Flashing effect
+  blinkStartPrompt();
+}
+
+// Flash the prompt under PRESS START on and off every half second
+void blinkStartPrompt() {
+  unsigned long currentTime = millis();
+  int promptY = (currentState == PRESS_START_P1) ? 250 : 270;
+  const char *prompt = (currentState == PRESS_START_P1) ? "TAP TO BEGIN!" : "YOUR TURN!";
+  
+  if ((currentTime / 500) % 2 == 0) {
+    tft.setTextColor(YELLOW);
     tft.setTextSize(2);
-    tft.setCursor(100, 140);
-    tft.print("Mode: ");
-    if (p2Difficulty == EASY) {
-      tft.setTextColor(GREEN);
-      tft.print("EASY");
-    } else {
-      tft.setTextColor(RED);
-      tft.print("SHRED GNAR");
-    }
-    
-    // Press start button
-    tft.drawRect(120, 180, 240, 80, BLUE);
-    tft.drawRect(121, 181, 238, 78, BLUE);
-    tft.fillRect(122, 182, 236, 76, RED);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(3);
-    tft.setCursor(140, 210);
-    tft.println("PRESS START");
-    
-    // Flashing effect
-    if ((currentTime / 500) % 2 == 0) {
-      tft.setTextColor(YELLOW);
-      tft.setTextSize(2);
-      tft.setCursor(150, 270);
-      tft.println("YOUR TURN!");
-    }
+    tft.setCursor(150, promptY);
+    tft.println(prompt);
+  } else {
+    tft.fillRect(150, promptY, strlen(prompt) * 12, 16, BLACK);
   }
+  timers.schedule(TIMER_BLINK, (currentTime / 500 + 1) * 500, blinkStartPrompt);
 }
 
 // New function to replace shouldShowSpecialChicken
@@ -1282,6 +1435,7 @@ void drawFireworksEffect(int x, int y, int intensity) {
       
       tft.fillCircle(sparkX, sparkY, random(2, 5), sparkColor);
     }
+    flushFrame(true);
     delay(50); // Brief delay between bursts
   }
 }
@@ -1549,526 +1703,580 @@ void drawPlasmaBlast(int x, int y) {
 void drawSpecialCharacter(int x, int y) {
   if (gameVariant == BONK_CHICKEN) {
     // Original blue chicken
-    tft.fillRect(x, y, specialChickenSize, specialChickenSize, BLUE);
-    tft.fillRect(x+specialChickenSize*2/3, y-3, 6, 8, MAGENTA);
-    tft.fillRect(x+specialChickenSize/6, y+specialChickenSize/6, 4, 4, WHITE);
-    tft.fillRect(x+specialChickenSize*2/3, y+specialChickenSize-4, 12, 4, PURPLE);
-    tft.fillRect(x-4, y+specialChickenSize-4, 12, 4, PURPLE);
-    tft.drawRect(x-1, y-1, specialChickenSize+2, specialChickenSize+2, CYAN);
-    tft.fillCircle(x-2, y-2, 2, WHITE);
-    tft.fillCircle(x+specialChickenSize+2, y-2, 2, WHITE);
-    tft.fillCircle(x-2, y+specialChickenSize+2, 2, WHITE);
-    tft.fillCircle(x+specialChickenSize+2, y+specialChickenSize+2, 2, WHITE);
+    drawCachedCharacter(SPRITE_SPECIAL_CHICKEN, x, y, false);
   } else if (gameVariant == BONK_BUNNY) {
-    // Easter egg
+    // Easter egg - spots are random every time, so never cached
     drawEgg(x, y);
   } else if (gameVariant == BONK_PATRIOTS) {
     // Patriotic star
-    drawStar(x, y);
+    drawCachedCharacter(SPRITE_STAR, x, y, false);
   } else if (gameVariant == BONK_BLUEY) {
     // Red balloon
-    drawBalloon(x, y);
+    drawCachedCharacter(SPRITE_BALLOON, x, y, false);
   } else if (gameVariant == BONK_DRAGONS) {
     // Fish for dragons to collect!
-    drawFish(x, y);
+    drawCachedCharacter(SPRITE_FISH, x, y, false);
   }
 }
 
-// Generic gameplay handler function
-void handleGameplay(GameState currentGameState) {
-  unsigned long currentTime = millis();
-  unsigned long gameElapsedTime = currentTime - stateStartTime;
-  
-  if (gameElapsedTime < 100) {
-    tft.fillScreen(BLACK);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.setCursor(10, 10);
-    tft.print("Time: ");
-    tft.print(timeLeft);
-    
-    updateScoreDisplay();
-    
-    tft.setCursor(10, 300);
-    tft.setTextSize(1);
-    
-    // Show player number in two-player mode
-    if (twoPlayerMode) {
-      tft.setTextColor(currentGameState == GAMEPLAY_P1 ? GREEN : RED);
-      tft.print(currentGameState == GAMEPLAY_P1 ? "PLAYER 1 " : "PLAYER 2 ");
-    }
-    
-    if (currentPlayerDifficulty == EASY) {
-      tft.setTextColor(GREEN);
-      tft.print("EASY MODE");
-    } else {
-      tft.setTextColor(RED);
-      tft.print("SHRED GNAR MODE");
-    }
+// Procedural drawing for each sprite kind, used by the sprite cache on a miss.
+// Random flames are left out; drawCachedCharacter adds them after the blit.
+void rasterizeSprite(uint8_t kind, int x, int y) {
+  bool withFlames = (kind & SPRITE_WITH_FLAMES) != 0;
+  switch (kind & ~SPRITE_WITH_FLAMES) {
+    case SPRITE_CHICKEN:         drawChicken(x, y, false); break;
+    case SPRITE_BUNNY:           drawBunny(x, y, false); break;
+    case SPRITE_FLAG:            drawFlag(x, y, false); break;
+    case SPRITE_BLUEY:           drawBluey(x, y, false); break;
+    case SPRITE_BINGO:           drawBingo(x, y, false); break;
+    case SPRITE_TOOTHLESS:       drawToothless(x, y, withFlames); break;
+    case SPRITE_LIGHT_FURY:      drawLightFury(x, y, withFlames); break;
+    case SPRITE_SPECIAL_CHICKEN: drawSpecialChicken(x, y); break;
+    case SPRITE_STAR:            drawStar(x, y); break;
+    case SPRITE_BALLOON:         drawBalloon(x, y); break;
+    case SPRITE_FISH:            drawFish(x, y); break;
   }
 }
 
-// The original gameplay handler code repurposed to work with our new structure
-void handleOriginalGameplayLogic(unsigned long currentTime) {
-  // Update timer
-  if (currentTime - lastTimerUpdate >= 1000) {
-    lastTimerUpdate = currentTime;
-    timeLeft--;
-    tft.fillRect(10, 0, 100, 30, BLACK);
-    tft.setCursor(10, 10);
-    tft.setTextColor(WHITE);
-    tft.setTextSize(2);
-    tft.print("Time: ");
-    tft.print(timeLeft);
+// Draw a character through the sprite cache. Flame effects are random on
+// every spawn so they go on top of the cached body, exactly where the
+// procedural draw functions put them.
+void drawCachedCharacter(uint8_t kind, int x, int y, bool withFlames) {
+  bool special = (kind >= SPRITE_SPECIAL_CHICKEN);
+  int size = special ? specialChickenSize : currentChickenSize;
+  bool dragon = (kind == SPRITE_TOOTHLESS || kind == SPRITE_LIGHT_FURY);
+
+#if SPRITE_CACHE_ENABLED
+  if (dragon && withFlames) {
+    sprites.draw(kind | SPRITE_WITH_FLAMES, size, x, y);
+  } else {
+    sprites.draw(kind, size, x, y);
+  }
+#else
+  rasterizeSprite((dragon && withFlames) ? (kind | SPRITE_WITH_FLAMES) : kind, x, y);
+#endif
+
+  if (withFlames && !dragon && !special) {
+    drawFlameEffect(x, y, flameEffectIntensity);
   }
+}
+
+// Render cost so far, logged when a round ends
+void reportRenderStats() {
+  telemetry.log(TELEM_ROUND_END, sprites.hitRate(), tft.totalBytes(), tft.frameCount());
+  telemetry.log(TELEM_CACHE, 0, sprites.spriteCount(), sprites.memoryUsed());
+}
+
+// Gameplay setup: draw the HUD once and arm the round's deadlines
+void enterGameplay(GameState currentGameState) {
+  tft.fillScreen(BLACK);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.setCursor(10, 10);
+  tft.print("Time: ");
+  tft.print(timeLeft);
   
-  // Handle feedback effects
-  if (showFeedback) {
-    // Track plasma beam variables
-    static float plasmaAngle = 0;
-    static int plasmaStartX = 0;
-    static int plasmaStartY = 0;
-    static int lastBeamEndX = 0;
-    static int lastBeamEndY = 0;
-    
-    if (currentTime - feedbackTime < 300) {
-      // ALL variants get the green flash feedback
-      if ((currentTime - feedbackTime) % 100 < 50) {
-        tft.fillCircle(tft.width()/2, tft.height()/2, 20, GREEN);
-      } else {
-        tft.fillCircle(tft.width()/2, tft.height()/2, 20, BLACK);
-      }
-      
-      // Dragons ALSO get a plasma blast that shoots across screen
-      if (gameVariant == BONK_DRAGONS && currentTime - feedbackTime < 200) {
-        if (currentTime - feedbackTime < 20) {
-          // Initialize plasma beam on first frame
-          plasmaAngle = random(0, 628) / 100.0; // Random angle in radians
-          plasmaStartX = chickenX + currentChickenSize/2;
-          plasmaStartY = chickenY + currentChickenSize/2;
-        }
-        
-        // Draw plasma beam shooting outward
-        int beamLength = (currentTime - feedbackTime) * 3; // Grows over time
-        int beamEndX = plasmaStartX + cos(plasmaAngle) * beamLength;
-        int beamEndY = plasmaStartY + sin(plasmaAngle) * beamLength;
-        
-        // Save the end position for clearing later
-        lastBeamEndX = beamEndX;
-        lastBeamEndY = beamEndY;
-        
-        // Draw beam with glow effect
-        tft.drawLine(plasmaStartX, plasmaStartY, beamEndX, beamEndY, PLASMA_BLUE);
-        tft.drawLine(plasmaStartX-1, plasmaStartY, beamEndX-1, beamEndY, CYAN);
-        tft.drawLine(plasmaStartX+1, plasmaStartY, beamEndX+1, beamEndY, CYAN);
-        tft.drawLine(plasmaStartX, plasmaStartY-1, beamEndX, beamEndY-1, CYAN);
-        tft.drawLine(plasmaStartX, plasmaStartY+1, beamEndX, beamEndY+1, CYAN);
-        
-        // Clear behind the beam as it travels
-        if (beamLength > 50) {
-          int clearStartX = plasmaStartX + cos(plasmaAngle) * (beamLength - 50);
-          int clearStartY = plasmaStartY + sin(plasmaAngle) * (beamLength - 50);
-          int clearEndX = plasmaStartX + cos(plasmaAngle) * (beamLength - 45);
-          int clearEndY = plasmaStartY + sin(plasmaAngle) * (beamLength - 45);
-          
-          // Clear with thick black line
-          for (int i = -2; i <= 2; i++) {
-            tft.drawLine(clearStartX+i, clearStartY, clearEndX+i, clearEndY, BLACK);
-            tft.drawLine(clearStartX, clearStartY+i, clearEndX, clearEndY+i, BLACK);
-          }
-        }
-      }
-    } else if (currentTime - feedbackTime < 1500) {
-      // After 300ms but before 1500ms - clear any remaining plasma beam for dragons
-      if (gameVariant == BONK_DRAGONS && plasmaStartX > 0) {
-        // Clear the entire plasma beam path
-        for (int i = -3; i <= 3; i++) {
-          tft.drawLine(plasmaStartX+i, plasmaStartY, lastBeamEndX+i, lastBeamEndY, BLACK);
-          tft.drawLine(plasmaStartX, plasmaStartY+i, lastBeamEndX, lastBeamEndY+i, BLACK);
-        }
-        // Reset plasma variables
-        plasmaStartX = 0;
-        plasmaStartY = 0;
-        lastBeamEndX = 0;
-        lastBeamEndY = 0;
-      }
-    } else {
-      // After 1500ms - clear everything and stop feedback
-      tft.fillCircle(tft.width()/2, tft.height()/2, 20, BLACK);
-      showFeedback = false;
-    }
+  updateScoreDisplay();
+  
+  tft.setCursor(10, 300);
+  tft.setTextSize(1);
+  
+  // Show player number in two-player mode
+  if (twoPlayerMode) {
+    tft.setTextColor(currentGameState == GAMEPLAY_P1 ? GREEN : RED);
+    tft.print(currentGameState == GAMEPLAY_P1 ? "PLAYER 1 " : "PLAYER 2 ");
   }
   
-  // Handle frenzy mode
-  if (frenzyMode) {
-    if (currentTime - frenzyStartTime > frenzyDuration) {
-      frenzyMode = false;
-      bonkStreak = 0;
-      currentChickenDuration = max(initialChickenDuration - (score * speedIncreasePerBonk), minChickenDuration);
-    }
+  if (currentPlayerDifficulty == EASY) {
+    tft.setTextColor(GREEN);
+    tft.print("EASY MODE");
+  } else {
+    tft.setTextColor(RED);
+    tft.print("SHRED GNAR MODE");
   }
   
-  // Handle any text that needs to be shown temporarily
-  if (showFrenzyText) {
-    // For frenzy mode announcement
-    if (currentTime - frenzyTextTime < 1000) {
-      // Keep the text visible for 1 second
-      tft.setTextColor(RED);
-      tft.setTextSize(3);
-      tft.setCursor(150, 50);
-      if (gameVariant == BONK_PATRIOTS) {
-        tft.print("FREEDOM TIME!");
-      } else if (gameVariant == BONK_BLUEY) {
-        tft.print("DANCE MODE!");
-      } else if (gameVariant == BONK_DRAGONS) {
-        tft.print("DRAGON FURY!");  // Super cool dragon mode!
-      } else {
-        tft.print("TIME TO SHRED!");
-      }
-    } 
-    else if (currentTime - frenzyTextTime < 1100) {
-      // Clear the text after 1 second
-      tft.fillRect(150, 50, 240, 30, BLACK);
-      showFrenzyText = false;
+  // resetGameVariables() zeroed the last-update times, so the first tick
+  // and the first character are due straight away
+  timers.schedule(TIMER_CLOCK, lastTimerUpdate + 1000, countdownTick);
+  armCharacterTimers();
+  if (currentPlayerDifficulty == SHRED_GNAR) {
+    timers.schedule(TIMER_WANDER, stateStartTime, wanderSpecialCharacter);
+  }
+}
+
+// One second off the clock; ends the round at zero
+void countdownTick() {
+  unsigned long currentTime = millis();
+  lastTimerUpdate = currentTime;
+  timeLeft--;
+  tft.fillRect(10, 0, 100, 30, BLACK);
+  tft.setCursor(10, 10);
+  tft.setTextColor(WHITE);
+  tft.setTextSize(2);
+  tft.print("Time: ");
+  tft.print(timeLeft);
+  
+  // Check if game is over
+  if (timeLeft <= 0) {
+    if (currentState == GAMEPLAY_P1) {
+      savePlayerOneResults();
     }
+    reportRenderStats();
     
-    // For special character text clearing
-    if (currentTime - frenzyTextTime >= 1000 && lastSpecialChickenX > 0 && lastSpecialChickenY > 0) {
-      // Clear the text area
-      tft.fillRect(lastSpecialChickenX, lastSpecialChickenY, 100, 40, BLACK);
-      lastSpecialChickenX = 0;
-      lastSpecialChickenY = 0;
+    if (currentState == GAMEPLAY_P1 && twoPlayerMode) {
+      enterState(MODE_SELECT_P2);
+    } else {
+      enterState(RESULT_SCREEN);
     }
+    return;
+  }
+  
+  timers.schedule(TIMER_CLOCK, lastTimerUpdate + 1000, countdownTick);
+}
+
+// Both characters come and go every currentChickenDuration. That changes
+// as the player speeds up, so the deadlines are re-armed from the last
+// spawn/despawn time whenever it does.
+void armCharacterTimers() {
+  timers.schedule(TIMER_CHARACTER, lastChickenTime + currentChickenDuration, characterTimeout);
+  if (specialChickenId != ENTITY_NONE || showSpecialChicken) {
+    timers.schedule(TIMER_SPECIAL, lastSpecialChickenTime + currentChickenDuration, specialCharacterTimeout);
+  } else {
+    timers.cancel(TIMER_SPECIAL);
   }
+}
+
+// Regular character: spawn if hidden, despawn if showing
+void characterTimeout() {
+  unsigned long currentTime = millis();
   
-  // Handle regular character spawning
-  if (!chickenVisible && (currentTime - lastChickenTime >= (unsigned long)currentChickenDuration)) {
+  if (chickenId == ENTITY_NONE) {
     if (currentPlayerDifficulty == SHRED_GNAR) {
       currentChickenSize = random(30, 60);
     }
-    chickenX = random(currentChickenSize + 20, tft.width() - currentChickenSize - 20);
-    chickenY = random(40 + currentChickenSize, tft.height() - currentChickenSize - 20);
+    spawnCharacter(CHARACTER_REGULAR, currentChickenSize, &chickenId);
+    int chickenX = characters.x[chickenId];
+    int chickenY = characters.y[chickenId];
     
     // Draw the appropriate character based on game variant
     if (gameVariant == BONK_CHICKEN) {
-      drawChicken(chickenX, chickenY, showFlameEffect);
+      drawCachedCharacter(SPRITE_CHICKEN, chickenX, chickenY, showFlameEffect);
     } else if (gameVariant == BONK_BUNNY) {
-      drawBunny(chickenX, chickenY, showFlameEffect);
+      drawCachedCharacter(SPRITE_BUNNY, chickenX, chickenY, showFlameEffect);
     } else if (gameVariant == BONK_PATRIOTS) {
-      drawFlag(chickenX, chickenY, showFlameEffect);
+      drawCachedCharacter(SPRITE_FLAG, chickenX, chickenY, showFlameEffect);
     } else if (gameVariant == BONK_BLUEY) {
       // Randomly choose between Bluey and Bingo
       if (random(2) == 0) {
-        drawBluey(chickenX, chickenY, showFlameEffect);
+        drawCachedCharacter(SPRITE_BLUEY, chickenX, chickenY, showFlameEffect);
       } else {
-        drawBingo(chickenX, chickenY, showFlameEffect);
+        drawCachedCharacter(SPRITE_BINGO, chickenX, chickenY, showFlameEffect);
       }
     } else if (gameVariant == BONK_DRAGONS) {
       // Randomly choose between Toothless and Light Fury!
       if (random(2) == 0) {
-        drawToothless(chickenX, chickenY, showFlameEffect);
+        drawCachedCharacter(SPRITE_TOOTHLESS, chickenX, chickenY, showFlameEffect);
       } else {
-        drawLightFury(chickenX, chickenY, showFlameEffect);
+        drawCachedCharacter(SPRITE_LIGHT_FURY, chickenX, chickenY, showFlameEffect);
       }
     }
     
-    chickenVisible = true;
     lastChickenTime = currentTime;
     
     // Determine if special character should appear
-    if (!specialChickenVisible && shouldShowSpecialCharacter()) {
+    if (specialChickenId == ENTITY_NONE && shouldShowSpecialCharacter()) {
       showSpecialChicken = true;
     }
-    if (frenzyMode && !specialChickenVisible && random(100) < 20) {
+    if (frenzyMode && specialChickenId == ENTITY_NONE && random(100) < 20) {
       showSpecialChicken = true;
     }
   }
-  else if (chickenVisible && (currentTime - lastChickenTime >= (unsigned long)currentChickenDuration)) {
-    lastChickenX = chickenX;
-    lastChickenY = chickenY;
-    chickenDisappearTime = currentTime;
-    clearCharacter(chickenX, chickenY, currentChickenSize);
-    chickenVisible = false;
+  else {
+    despawnCharacter(&chickenId, currentTime);
     lastChickenTime = currentTime;
   }
   
-  // Handle special character spawning
-  if (showSpecialChicken && !specialChickenVisible && 
-      (currentTime - lastSpecialChickenTime >= (unsigned long)currentChickenDuration)) {
+  armCharacterTimers();
+}
+
+// Special character: spawn if one is owed, despawn if showing
+void specialCharacterTimeout() {
+  unsigned long currentTime = millis();
+  
+  if (specialChickenId == ENTITY_NONE && showSpecialChicken) {
     if (currentPlayerDifficulty == SHRED_GNAR) {
       specialChickenSize = random(20, 40);
     }
     
-    // Find a position that doesn't overlap with the main character
-    do {
-      specialChickenX = random(specialChickenSize + 20, tft.width() - specialChickenSize - 20);
-      specialChickenY = random(40 + specialChickenSize, tft.height() - specialChickenSize - 20);
-    } while (chickenVisible && 
-             abs(specialChickenX - chickenX) < 80 && 
-             abs(specialChickenY - chickenY) < 80);
+    // Placed clear of the main character, in a bounded number of tries
+    spawnCharacter(CHARACTER_SPECIAL, specialChickenSize, &specialChickenId);
     
     // Draw the appropriate special character
-    drawSpecialCharacter(specialChickenX, specialChickenY);
+    drawSpecialCharacter(characters.x[specialChickenId], characters.y[specialChickenId]);
     
-    specialChickenVisible = true;
     lastSpecialChickenTime = currentTime;
     showSpecialChicken = false;
   }
-  else if (specialChickenVisible && (currentTime - lastSpecialChickenTime >= (unsigned long)currentChickenDuration)) {
-    lastSpecialChickenX = specialChickenX;
-    lastSpecialChickenY = specialChickenY;
-    specialChickenDisappearTime = currentTime;
-    clearCharacter(specialChickenX, specialChickenY, specialChickenSize);
-    specialChickenVisible = false;
+  else if (specialChickenId != ENTITY_NONE) {
+    despawnCharacter(&specialChickenId, currentTime);
     lastSpecialChickenTime = currentTime;
   }
   
-  // Add movement to special character in SHRED_GNAR mode
-  if (currentPlayerDifficulty == SHRED_GNAR && specialChickenVisible) {
-    if (currentTime % 300 < 50) {
-      clearCharacter(specialChickenX, specialChickenY, specialChickenSize);
-      specialChickenX += random(-10, 11);
-      specialChickenY += random(-10, 11);
-      specialChickenX = constrain(specialChickenX, specialChickenSize + 20, tft.width() - specialChickenSize - 20);
-      specialChickenY = constrain(specialChickenY, 40 + specialChickenSize, tft.height() - specialChickenSize - 20);
-      drawSpecialCharacter(specialChickenX, specialChickenY);
-    }
-  }
+  armCharacterTimers();
 }
 
-// Connect gameplay handlers to original logic
-void handleGameplayP1() {
+// SHRED GNAR: the special character jitters for the first 50 ms of every
+// 300 ms, one step per compositor frame
+void wanderSpecialCharacter() {
   unsigned long currentTime = millis();
   
-  // Call the generic game display function
-  handleGameplay(GAMEPLAY_P1);
+  if (specialChickenId != ENTITY_NONE && currentTime % 300 < 50) {
+    int specialChickenX = characters.x[specialChickenId];
+    int specialChickenY = characters.y[specialChickenId];
+    clearCharacter(specialChickenX, specialChickenY, specialChickenSize);
+    specialChickenX += random(-10, 11);
+    specialChickenY += random(-10, 11);
+    specialChickenX = constrain(specialChickenX, specialChickenSize + 20, tft.width() - specialChickenSize - 20);
+    specialChickenY = constrain(specialChickenY, 40 + specialChickenSize, tft.height() - specialChickenSize - 20);
+    entityMove(&characters, specialChickenId, specialChickenX, specialChickenY);
+    drawSpecialCharacter(specialChickenX, specialChickenY);
+  }
   
-  // Run the actual gameplay logic
-  handleOriginalGameplayLogic(currentTime);
+  unsigned long next = currentTime + COMPOSITOR_FRAME_MS;
+  if (next % 300 >= 50) {
+    next += 300 - next % 300;
+  }
+  timers.schedule(TIMER_WANDER, next, wanderSpecialCharacter);
+}
+
+// A hit: green flash for everyone, plus a plasma beam for Dragons fired
+// from the character that was hit
+void startFeedback(unsigned long now, EntityId hit) {
+  showFeedback = true;
+  feedbackTime = now;
+  timers.schedule(TIMER_FEEDBACK, now, feedbackStep);
+  
+  if (gameVariant == BONK_DRAGONS) {
+    plasmaAngle = random(0, 628) / 100.0; // Random angle in radians
+    plasmaStartX = characters.x[hit] + characters.size[hit]/2;
+    plasmaStartY = characters.y[hit] + characters.size[hit]/2;
+    lastBeamLength = 0;
+    timers.schedule(TIMER_PLASMA, now, plasmaStep);
+  }
+}
+
+void feedbackStep() {
+  unsigned long elapsed = millis() - feedbackTime;
   
-  // Check if game is over
-  if (timeLeft <= 0) {
-    savePlayerOneResults();
-    
-    if (twoPlayerMode) {
-      currentState = MODE_SELECT_P2;
+  if (elapsed < 300) {
+    // Flash toggles every 50 ms
+    if (elapsed % 100 < 50) {
+      tft.fillCircle(tft.width()/2, tft.height()/2, 20, GREEN);
     } else {
-      currentState = RESULT_SCREEN;
+      tft.fillCircle(tft.width()/2, tft.height()/2, 20, BLACK);
     }
-    
-    stateStartTime = currentTime;
-    return;
+    timers.schedule(TIMER_FEEDBACK, feedbackTime + (elapsed / 50 + 1) * 50, feedbackStep);
+  } else if (elapsed < 1500) {
+    // After 300ms - clear any remaining plasma beam for dragons
+    clearPlasmaBeam();
+    timers.schedule(TIMER_FEEDBACK, feedbackTime + 1500, feedbackStep);
+  } else {
+    // After 1500ms - clear everything and stop feedback
+    tft.fillCircle(tft.width()/2, tft.height()/2, 20, BLACK);
+    showFeedback = false;
   }
 }
 
-void handleGameplayP2() {
-  unsigned long currentTime = millis();
+// Dragons plasma beam, grown once per compositor frame for 200 ms
+void plasmaStep() {
+  unsigned long elapsed = millis() - feedbackTime;
+  if (elapsed >= 200) return;
+  
+  // Draw plasma beam shooting outward
+  int beamLength = elapsed * 3; // Grows over time
+  int beamEndX = plasmaStartX + cos(plasmaAngle) * beamLength;
+  int beamEndY = plasmaStartY + sin(plasmaAngle) * beamLength;
+  
+  // Save the end position for clearing later
+  lastBeamEndX = beamEndX;
+  lastBeamEndY = beamEndY;
+  
+  // Draw beam with glow effect
+  tft.drawLine(plasmaStartX, plasmaStartY, beamEndX, beamEndY, PLASMA_BLUE);
+  tft.drawLine(plasmaStartX-1, plasmaStartY, beamEndX-1, beamEndY, CYAN);
+  tft.drawLine(plasmaStartX+1, plasmaStartY, beamEndX+1, beamEndY, CYAN);
+  tft.drawLine(plasmaStartX, plasmaStartY-1, beamEndX, beamEndY-1, CYAN);
+  tft.drawLine(plasmaStartX, plasmaStartY+1, beamEndX, beamEndY+1, CYAN);
+  
+  // Clear behind the beam as it travels, covering everything it grew by
+  // since the last step
+  if (beamLength > 50) {
+    int clearFrom = max(lastBeamLength - 50, 0);
+    int clearStartX = plasmaStartX + cos(plasmaAngle) * clearFrom;
+    int clearStartY = plasmaStartY + sin(plasmaAngle) * clearFrom;
+    int clearEndX = plasmaStartX + cos(plasmaAngle) * (beamLength - 45);
+    int clearEndY = plasmaStartY + sin(plasmaAngle) * (beamLength - 45);
+    
+    // Clear with thick black line
+    for (int i = -2; i <= 2; i++) {
+      tft.drawLine(clearStartX+i, clearStartY, clearEndX+i, clearEndY, BLACK);
+      tft.drawLine(clearStartX, clearStartY+i, clearEndX, clearEndY+i, BLACK);
+    }
+  }
+  lastBeamLength = beamLength;
   
-  // Call the generic game display function
-  handleGameplay(GAMEPLAY_P2);
+  timers.schedule(TIMER_PLASMA, millis() + COMPOSITOR_FRAME_MS, plasmaStep);
+}
+
+void clearPlasmaBeam() {
+  if (gameVariant == BONK_DRAGONS && plasmaStartX > 0) {
+    // Clear the entire plasma beam path
+    for (int i = -3; i <= 3; i++) {
+      tft.drawLine(plasmaStartX+i, plasmaStartY, lastBeamEndX+i, lastBeamEndY, BLACK);
+      tft.drawLine(plasmaStartX, plasmaStartY+i, lastBeamEndX, lastBeamEndY+i, BLACK);
+    }
+    // Reset plasma variables
+    plasmaStartX = 0;
+    plasmaStartY = 0;
+    lastBeamEndX = 0;
+    lastBeamEndY = 0;
+  }
+}
+
+// Frenzy announcement (also raised by special character hits), shown for
+// one second. Drawn from the timer so it lands on top of anything the tap
+// handler clears.
+void startFrenzyText(unsigned long now) {
+  showFrenzyText = true;
+  frenzyTextTime = now;
+  timers.schedule(TIMER_TEXT, now, frenzyTextStep);
+}
+
+void frenzyTextStep() {
+  if (millis() - frenzyTextTime < 1000) {
+    tft.setTextColor(RED);
+    tft.setTextSize(3);
+    tft.setCursor(150, 50);
+    if (gameVariant == BONK_PATRIOTS) {
+      tft.print("FREEDOM TIME!");
+    } else if (gameVariant == BONK_BLUEY) {
+      tft.print("DANCE MODE!");
+    } else if (gameVariant == BONK_DRAGONS) {
+      tft.print("DRAGON FURY!");  // Super cool dragon mode!
+    } else {
+      tft.print("TIME TO SHRED!");
+    }
+    timers.schedule(TIMER_TEXT, frenzyTextTime + 1000, frenzyTextStep);
+    return;
+  }
   
-  // Run the actual gameplay logic
-  handleOriginalGameplayLogic(currentTime);
+  // Clear the text after 1 second
+  tft.fillRect(150, 50, 240, 30, BLACK);
+  showFrenzyText = false;
   
-  // Check if game is over
-  if (timeLeft <= 0) {
-    currentState = RESULT_SCREEN;
-    stateStartTime = currentTime;
-    return;
+  // For special character text clearing
+  if (specialTextX > 0 && specialTextY > 0) {
+    tft.fillRect(specialTextX, specialTextY, 100, 40, BLACK);
+    specialTextX = 0;
+    specialTextY = 0;
   }
 }
 
-void handleResultScreen() {
-  unsigned long currentTime = millis();
-  unsigned long elapsedTime = currentTime - stateStartTime;
+void frenzyExpired() {
+  frenzyMode = false;
+  bonkStreak = 0;
+  currentChickenDuration = max(initialChickenDuration - (score * speedIncreasePerBonk), minChickenDuration);
+  armCharacterTimers();
+}
+
+// Final results, shown once; back to game selection after 5 seconds
+void enterResultScreen() {
+  tft.fillScreen(BLACK);
+  tft.setTextSize(3);
   
-  if (elapsedTime < 100) {
-    tft.fillScreen(BLACK);
-    tft.setTextSize(3);
-    
-    // Determine win thresholds based on difficulty and create total scores
-    int p1WinThreshold = (p1Difficulty == EASY) ? 20 : 45;
-    int p2WinThreshold = (p2Difficulty == EASY) ? 20 : 45;
-    int p1TotalScore = p1Score + (p1SpecialScore * 3);
-    int p2TotalScore = p2Score + (p2SpecialScore * 3);
-    bool p1Win = p1TotalScore >= p1WinThreshold;
-    bool p2Win = p2TotalScore >= p2WinThreshold;
-    
-    // For single player mode
-    if (!twoPlayerMode) {
-      // Regular single player result screen
-      if (p1Win) {
-        tft.setTextColor(GREEN);
-        tft.setCursor(50, 80);
-        if (gameVariant == BONK_PATRIOTS) {
-          tft.println("FREEDOM");
-          tft.setCursor(90, 120);
-          tft.println("ACHIEVED!");
-        } else {
-          tft.println("YOU SHREDDED");
-          tft.setCursor(120, 120);
-          tft.println("GNAR!");
-        }
-        tft.fillCircle(240, 200, 30, YELLOW);
-        tft.fillCircle(225, 190, 5, BLACK);
-        tft.fillCircle(255, 190, 5, BLACK);
-        for (int i = 0; i < 21; i++) {
-          int x = 230 + i;
-          int y = 205 + sin((i - 10) * 0.1) * 6;
-          tft.fillCircle(x, y, 2, BLACK);
-        }
-      } else {
-        tft.setTextColor(RED);
-        tft.setCursor(70, 80);
-        if (gameVariant == BONK_PATRIOTS) {
-          tft.println("FREEDOM");
-          tft.setCursor(70, 120);
-          tft.println("PENDING...");
-        } else {
-          tft.println("GNAR");
-          tft.setCursor(70, 120);
-          tft.println("UN-SHREDDED");
-        }
-        tft.fillCircle(240, 200, 30, RED);
-        tft.fillCircle(225, 190, 5, BLACK);
-        tft.fillCircle(255, 190, 5, BLACK);
-        for (int i = 0; i < 21; i++) {
-          int x = 230 + i;
-          int y = 205 + sin((i - 10) * 0.1) * 6;
-          tft.fillCircle(x, y, 2, BLACK);
-        }
-      }
-      
-      // Display score information
-      String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
-                         (gameVariant == BONK_BUNNY) ? "HOPS: " : 
-                         (gameVariant == BONK_PATRIOTS) ? "FLAGS: " : 
-                         (gameVariant == BONK_BLUEY) ? "TAPS: " : "RIDES: ";
-      String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
-                           (gameVariant == BONK_BUNNY) ? "EGGS: " : 
-                           (gameVariant == BONK_PATRIOTS) ? "STARS: " : 
-                           (gameVariant == BONK_BLUEY) ? "BALLOONS: " : "FISH: ";
-      
-      tft.setTextColor(WHITE);
-      tft.setCursor(120, 240);
-      tft.print(scoreLabel);
-      tft.print(p1Score);
-      tft.setTextColor(CYAN);
-      tft.setCursor(120, 270);
-      tft.print(specialLabel);
-      tft.print(p1SpecialScore);
-      
+  // Determine win thresholds based on difficulty and create total scores
+  int p1WinThreshold = (p1Difficulty == EASY) ? 20 : 45;
+  int p2WinThreshold = (p2Difficulty == EASY) ? 20 : 45;
+  int p1TotalScore = p1Score + (p1SpecialScore * 3);
+  int p2TotalScore = p2Score + (p2SpecialScore * 3);
+  bool p1Win = p1TotalScore >= p1WinThreshold;
+  bool p2Win = p2TotalScore >= p2WinThreshold;
+  
+  // For single player mode
+  if (!twoPlayerMode) {
+    // Regular single player result screen
+    if (p1Win) {
       tft.setTextColor(GREEN);
-      tft.setCursor(120, 300);
-      tft.print("Total: ");
-      tft.print(p1TotalScore);
-      
-      // Game mode information
-      tft.setTextSize(1);
-      tft.setCursor(10, 300);
-      if (p1Difficulty == EASY) {
-        tft.setTextColor(GREEN);
-        tft.print("EASY MODE");
+      tft.setCursor(50, 80);
+      if (gameVariant == BONK_PATRIOTS) {
+        tft.println("FREEDOM");
+        tft.setCursor(90, 120);
+        tft.println("ACHIEVED!");
       } else {
-        tft.setTextColor(RED);
-        tft.print("SHRED GNAR MODE");
+        tft.println("YOU SHREDDED");
+        tft.setCursor(120, 120);
+        tft.println("GNAR!");
       }
-    } 
-    // For two player mode
-    else {
-      tft.setTextColor(WHITE);
-      tft.setCursor(110, 30);
-      tft.println("FINAL RESULTS");
-      
-      // Player 1 results
-      tft.setTextColor(GREEN);
-      tft.setTextSize(2);
-      tft.setCursor(50, 70);
-      tft.print("Player 1: ");
-      
-      if (p1Win) {
-        tft.setTextColor(GREEN);
-        tft.print("WIN");
-        tft.fillCircle(380, 70, 15, GREEN);
-      } else {
-        tft.setTextColor(RED);
-        tft.print("LOSE");
-        tft.fillCircle(380, 70, 15, RED);
+      tft.fillCircle(240, 200, 30, YELLOW);
+      tft.fillCircle(225, 190, 5, BLACK);
+      tft.fillCircle(255, 190, 5, BLACK);
+      for (int i = 0; i < 21; i++) {
+        int x = 230 + i;
+        int y = 205 + sin((i - 10) * 0.1) * 6;
+        tft.fillCircle(x, y, 2, BLACK);
       }
-      
-      // Display P1 scores
-      String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
-                         (gameVariant == BONK_BUNNY) ? "HOPS: " : "FLAGS: ";
-      String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
-                           (gameVariant == BONK_BUNNY) ? "EGGS: " : "STARS: ";
-      
-      tft.setTextColor(WHITE);
-      tft.setCursor(70, 100);
-      tft.print(scoreLabel);
-      tft.print(p1Score);
-      
-      tft.setCursor(70, 120);
-      tft.print(specialLabel);
-      tft.print(p1SpecialScore);
-      
-      tft.setTextColor(YELLOW);
-      tft.setCursor(70, 140);
-      tft.print("TOTAL: ");
-      tft.print(p1TotalScore);
-      
-      // Player 2 results
+    } else {
       tft.setTextColor(RED);
-      tft.setCursor(50, 180);
-      tft.print("Player 2: ");
-      
-      if (p2Win) {
-        tft.setTextColor(GREEN);
-        tft.print("WIN");
-        tft.fillCircle(380, 180, 15, GREEN);
+      tft.setCursor(70, 80);
+      if (gameVariant == BONK_PATRIOTS) {
+        tft.println("FREEDOM");
+        tft.setCursor(70, 120);
+        tft.println("PENDING...");
       } else {
-        tft.setTextColor(RED);
-        tft.print("LOSE");
-        tft.fillCircle(380, 180, 15, RED);
+        tft.println("GNAR");
+        tft.setCursor(70, 120);
+        tft.println("UN-SHREDDED");
       }
-      
-      // Display P2 scores
-      tft.setTextColor(WHITE);
-      tft.setCursor(70, 210);
-      tft.print(scoreLabel);
-      tft.print(p2Score);
-      
-      tft.setCursor(70, 230);
-      tft.print(specialLabel);
-      tft.print(p2SpecialScore);
-      
-      tft.setTextColor(YELLOW);
-      tft.setCursor(70, 250);
-      tft.print("TOTAL: ");
-      tft.print(p2TotalScore);
-      
-      // Final winner declaration
-      tft.setTextSize(3);
-      tft.setCursor(120, 280);
-      
-      if (p1TotalScore > p2TotalScore) {
-        tft.setTextColor(GREEN);
-        tft.print("P1 WINS!");
-      } else if (p2TotalScore > p1TotalScore) {
-        tft.setTextColor(RED);
-        tft.print("P2 WINS!");
-      } else {
-        tft.setTextColor(YELLOW);
-        tft.print("TIE GAME!");
+      tft.fillCircle(240, 200, 30, RED);
+      tft.fillCircle(225, 190, 5, BLACK);
+      tft.fillCircle(255, 190, 5, BLACK);
+      for (int i = 0; i < 21; i++) {
+        int x = 230 + i;
+        int y = 205 + sin((i - 10) * 0.1) * 6;
+        tft.fillCircle(x, y, 2, BLACK);
       }
     }
+    
+    // Display score information
+    String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
+                       (gameVariant == BONK_BUNNY) ? "HOPS: " : 
+                       (gameVariant == BONK_PATRIOTS) ? "FLAGS: " : 
+                       (gameVariant == BONK_BLUEY) ? "TAPS: " : "RIDES: ";
+    String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
+                         (gameVariant == BONK_BUNNY) ? "EGGS: " : 
+                         (gameVariant == BONK_PATRIOTS) ? "STARS: " : 
+                         (gameVariant == BONK_BLUEY) ? "BALLOONS: " : "FISH: ";
+    
+    tft.setTextColor(WHITE);
+    tft.setCursor(120, 240);
+    tft.print(scoreLabel);
+    tft.print(p1Score);
+    tft.setTextColor(CYAN);
+    tft.setCursor(120, 270);
+    tft.print(specialLabel);
+    tft.print(p1SpecialScore);
+    
+    tft.setTextColor(GREEN);
+    tft.setCursor(120, 300);
+    tft.print("Total: ");
+    tft.print(p1TotalScore);
+    
+    // Game mode information
+    tft.setTextSize(1);
+    tft.setCursor(10, 300);
+    if (p1Difficulty == EASY) {
+      tft.setTextColor(GREEN);
+      tft.print("EASY MODE");
+    } else {
+      tft.setTextColor(RED);
+      tft.print("SHRED GNAR MODE");
+    }
+  } 
+  // For two player mode
+  else {
+    tft.setTextColor(WHITE);
+    tft.setCursor(110, 30);
+    tft.println("FINAL RESULTS");
+    
+    // Player 1 results
+    tft.setTextColor(GREEN);
+    tft.setTextSize(2);
+    tft.setCursor(50, 70);
+    tft.print("Player 1: ");
+    
+    if (p1Win) {
+      tft.setTextColor(GREEN);
+      tft.print("WIN");
+      tft.fillCircle(380, 70, 15, GREEN);
+    } else {
+      tft.setTextColor(RED);
+      tft.print("LOSE");
+      tft.fillCircle(380, 70, 15, RED);
+    }
+    
+    // Display P1 scores
+    String scoreLabel = (gameVariant == BONK_CHICKEN) ? "BONKS: " : 
+                       (gameVariant == BONK_BUNNY) ? "HOPS: " : "FLAGS: ";
+    String specialLabel = (gameVariant == BONK_CHICKEN) ? "SPECIAL: " : 
+                         (gameVariant == BONK_BUNNY) ? "EGGS: " : "STARS: ";
+    
+    tft.setTextColor(WHITE);
+    tft.setCursor(70, 100);
+    tft.print(scoreLabel);
+    tft.print(p1Score);
+    
+    tft.setCursor(70, 120);
+    tft.print(specialLabel);
+    tft.print(p1SpecialScore);
+    
+    tft.setTextColor(YELLOW);
+    tft.setCursor(70, 140);
+    tft.print("TOTAL: ");
+    tft.print(p1TotalScore);
+    
+    // Player 2 results
+    tft.setTextColor(RED);
+    tft.setCursor(50, 180);
+    tft.print("Player 2: ");
+    
+    if (p2Win) {
+      tft.setTextColor(GREEN);
+      tft.print("WIN");
+      tft.fillCircle(380, 180, 15, GREEN);
+    } else {
+      tft.setTextColor(RED);
+      tft.print("LOSE");
+      tft.fillCircle(380, 180, 15, RED);
+    }
+    
+    // Display P2 scores
+    tft.setTextColor(WHITE);
+    tft.setCursor(70, 210);
+    tft.print(scoreLabel);
+    tft.print(p2Score);
+    
+    tft.setCursor(70, 230);
+    tft.print(specialLabel);
+    tft.print(p2SpecialScore);
+    
+    tft.setTextColor(YELLOW);
+    tft.setCursor(70, 250);
+    tft.print("TOTAL: ");
+    tft.print(p2TotalScore);
+    
+    // Final winner declaration
+    tft.setTextSize(3);
+    tft.setCursor(120, 280);
+    
+    if (p1TotalScore > p2TotalScore) {
+      tft.setTextColor(GREEN);
+      tft.print("P1 WINS!");
+    } else if (p2TotalScore > p1TotalScore) {
+      tft.setTextColor(RED);
+      tft.print("P2 WINS!");
+    } else {
+      tft.setTextColor(YELLOW);
+      tft.print("TIE GAME!");
+    }
   }
   
   // After 5 seconds, return to game select
-  if (elapsedTime >= 5000) {
-    currentState = GAME_SELECT;
-    stateStartTime = currentTime;
-    loadScreenPhase = 0;
-  }
+  timers.schedule(TIMER_STATE, stateStartTime + 5000, leaveResultScreen);
+}
+
+void leaveResultScreen() {
+  loadScreenPhase = 0;
+  enterState(GAME_SELECT);
 }
 
 void drawChicken(int x, int y, bool withFlames) {
@@ -0,0 +1,724 @@
+/*
+ * compositor.h - Dirty-rectangle compositor for BONK REV8.0 Dragons
+ *
+ * Sits between the game and the ILI9488_t3 panel driver. Every drawing call
+ * the game makes (fillRect, fillCircle, drawLine, print, ...) is rasterized
+ * into a palette-indexed shadow framebuffer in RAM instead of going straight
+ * out over SPI. Only pixels that actually change are recorded as damage, the
+ * damaged rectangles are merged, and once per frame each merged region is
+ * converted to RGB565 in a small tile buffer and pushed with one address
+ * window per band.
+ *
+ * The primitives follow the same rasterization rules as ILI9488_t3 /
+ * Adafruit_GFX, so what ends up on the panel is pixel-identical to drawing
+ * directly - it just arrives in far fewer, larger SPI bursts.
+ *
+ * Memory: 480x320 x 8-bit shadow buffer (150 KB, DMAMEM on Teensy 4.x)
+ *       + 8 KB tile buffer + 512 byte palette.
+ */
+
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <Arduino.h>
+#include <ILI9488_t3.h>
+
+#ifndef DMAMEM
+#define DMAMEM
+#endif
+
+// Panel geometry after setRotation(1)
+#define COMPOSITOR_WIDTH        480
+#define COMPOSITOR_HEIGHT       320
+
+// Damage list and push buffer sizes
+#define COMPOSITOR_MAX_DAMAGE   16
+#define COMPOSITOR_TILE_PIXELS  4096   // 8 KB of RGB565 per burst
+
+// ILI9488 only accepts 18-bit color over SPI, so each pixel costs 3 bytes on
+// the wire; setting the address window costs 2 commands + 8 data bytes + RAMWR.
+#define COMPOSITOR_BYTES_PER_PIXEL  3
+#define COMPOSITOR_WINDOW_OVERHEAD  11
+
+// Palette indices 0..254 hold colors; 255 marks "not drawn" in sprite captures
+#define COMPOSITOR_PALETTE_SIZE 255
+#define COMPOSITOR_TRANSPARENT  255
+
+// Default frame cadence (~60 Hz)
+#define COMPOSITOR_FRAME_MS     16
+
+// 5x7 classic font shipped with ILI9488_t3 (glcdfont.c)
+extern "C" const unsigned char glcdfont[];
+
+// Shadow framebuffer - one palette index per pixel
+DMAMEM static uint8_t compositorFrame[COMPOSITOR_HEIGHT][COMPOSITOR_WIDTH];
+
+struct DamageRect {
+  int16_t x0, y0, x1, y1;  // Inclusive corners
+};
+
+class Compositor : public Print {
+public:
+  Compositor(ILI9488_t3 &panel) : panel(panel) {}
+
+  // Call after panel.begin()/setRotation(). Clears the shadow buffer to
+  // the given color and forces one full-screen push.
+  void begin(uint16_t clearColor) {
+    paletteCount = 0;
+    lastColor = 0;
+    lastIndex = 0;
+    paletteRebuilds = 0;
+    paletteMisses = 0;
+    paletteGen++;
+    memset(compositorFrame, colorIndex(clearColor), sizeof(compositorFrame));
+    damageCount = 0;
+    addDamage(0, 0, COMPOSITOR_WIDTH - 1, COMPOSITOR_HEIGHT - 1);
+    cursorX = cursorY = 0;
+    textSize = 1;
+    textColor = textBgColor = 0xFFFF;
+    lastFlushTime = 0;
+    framesFlushed = 0;
+    bytesPushedTotal = 0;
+    bytesPushedLastFrame = 0;
+    regionsLastFrame = 0;
+    flush();
+  }
+
+  void setFrameInterval(unsigned long ms) { frameInterval = ms; }
+
+  // ==================== FRAME CONTROL ====================
+
+  // Push all pending damage if a frame interval has elapsed since the last flush
+  void flushIfDue(unsigned long now) {
+    if (now - lastFlushTime >= frameInterval) {
+      lastFlushTime = now;
+      flush();
+    }
+  }
+
+  // Earliest time flushIfDue() will push again
+  unsigned long nextFlushAt() const { return lastFlushTime + frameInterval; }
+
+  // Push all pending damage right now
+  void flush() {
+    uint32_t frameBytes = 0;
+    regionsLastFrame = damageCount;
+
+    for (int i = 0; i < damageCount; i++) {
+      frameBytes += pushRegion(damage[i]);
+    }
+    damageCount = 0;
+
+    if (frameBytes > 0) {
+      framesFlushed++;
+    }
+    bytesPushedLastFrame = frameBytes;
+    bytesPushedTotal += frameBytes;
+  }
+
+  // SPI traffic counters
+  uint32_t lastFrameBytes() const { return bytesPushedLastFrame; }
+  uint32_t totalBytes() const { return bytesPushedTotal; }
+  uint32_t frameCount() const { return framesFlushed; }
+  int lastFrameRegions() const { return regionsLastFrame; }
+  int pendingRegions() const { return damageCount; }
+
+  // Drawing calls rasterized so far (sprite blits count as one)
+  uint32_t primitiveCount() const { return primitivesDrawn; }
+
+  // Palette counters: colors in use, times a full palette was rebuilt, and
+  // colors that still found no slot and were drawn as the nearest one
+  int paletteColors() const {
+    int n = 0;
+    for (int i = 0; i < paletteCount; i++) n += paletteLive[i];
+    return n;
+  }
+  uint32_t paletteRebuildCount() const { return paletteRebuilds; }
+  uint32_t paletteMissCount() const { return paletteMisses; }
+
+  // Changes whenever palette indices handed out earlier may have been
+  // reused, so anything caching indices (the sprite cache) must drop them
+  uint32_t paletteGeneration() const { return paletteGen; }
+
+  // ==================== ILI9488_t3 COMPATIBLE API ====================
+
+  int16_t width() const { return COMPOSITOR_WIDTH; }
+  int16_t height() const { return COMPOSITOR_HEIGHT; }
+
+  void fillScreen(uint16_t color) {
+    fillRect(0, 0, COMPOSITOR_WIDTH, COMPOSITOR_HEIGHT, color);
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    beginOp();
+    plot(x, y, colorIndex(color));
+    endOp();
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    beginOp();
+    hline(x, y, w, colorIndex(color));
+    endOp();
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    beginOp();
+    vline(x, y, h, colorIndex(color));
+    endOp();
+  }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    beginOp();
+    fill(x, y, w, h, colorIndex(color));
+    endOp();
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    uint8_t c = colorIndex(color);
+    beginOp();
+    hline(x, y, w, c);
+    hline(x, y + h - 1, w, c);
+    vline(x, y, h, c);
+    vline(x + w - 1, y, h, c);
+    endOp();
+  }
+
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    beginOp();
+    line(x0, y0, x1, y1, colorIndex(color));
+    endOp();
+  }
+
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    uint8_t c = colorIndex(color);
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    beginOp();
+    plot(x0, y0 + r, c);
+    plot(x0, y0 - r, c);
+    plot(x0 + r, y0, c);
+    plot(x0 - r, y0, c);
+
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      plot(x0 + x, y0 + y, c);
+      plot(x0 - x, y0 + y, c);
+      plot(x0 + x, y0 - y, c);
+      plot(x0 - x, y0 - y, c);
+      plot(x0 + y, y0 + x, c);
+      plot(x0 - y, y0 + x, c);
+      plot(x0 + y, y0 - x, c);
+      plot(x0 - y, y0 - x, c);
+    }
+    endOp();
+  }
+
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    uint8_t c = colorIndex(color);
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    beginOp();
+    vline(x0, y0 - r, 2 * r + 1, c);
+
+    while (x < y) {
+      if (f >= 0) {
+        y--;
+        ddF_y += 2;
+        f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      vline(x0 + x, y0 - y, 2 * y + 1, c);
+      vline(x0 + y, y0 - x, 2 * x + 1, c);
+      vline(x0 - x, y0 - y, 2 * y + 1, c);
+      vline(x0 - y, y0 - x, 2 * x + 1, c);
+    }
+    endOp();
+  }
+
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color) {
+    uint8_t c = colorIndex(color);
+    int16_t a, b, y, last;
+
+    // Sort coordinates by Y order (y2 >= y1 >= y0)
+    if (y0 > y1) { swapInt(y0, y1); swapInt(x0, x1); }
+    if (y1 > y2) { swapInt(y2, y1); swapInt(x2, x1); }
+    if (y0 > y1) { swapInt(y0, y1); swapInt(x0, x1); }
+
+    beginOp();
+
+    // Handle awkward all-on-same-line case as its own thing
+    if (y0 == y2) {
+      a = b = x0;
+      if (x1 < a) a = x1;
+      else if (x1 > b) b = x1;
+      if (x2 < a) a = x2;
+      else if (x2 > b) b = x2;
+      hline(a, y0, b - a + 1, c);
+      endOp();
+      return;
+    }
+
+    int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+    int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+    int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+    int32_t sa = 0, sb = 0;
+
+    // Upper part of triangle; include scanline y1 only if the lower part is flat
+    last = (y1 == y2) ? y1 : y1 - 1;
+
+    for (y = y0; y <= last; y++) {
+      a = x0 + sa / dy01;
+      b = x0 + sb / dy02;
+      sa += dx01;
+      sb += dx02;
+      if (a > b) swapInt(a, b);
+      hline(a, y, b - a + 1, c);
+    }
+
+    // Lower part of triangle
+    sa = dx12 * (y - y1);
+    sb = dx02 * (y - y0);
+    for (; y <= y2; y++) {
+      a = x1 + sa / dy12;
+      b = x0 + sb / dy02;
+      sa += dx12;
+      sb += dx02;
+      if (a > b) swapInt(a, b);
+      hline(a, y, b - a + 1, c);
+    }
+    endOp();
+  }
+
+  // ==================== TEXT ====================
+
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  void setTextColor(uint16_t c) { textColor = textBgColor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textColor = c; textBgColor = bg; }
+  void setTextSize(uint8_t s) { textSize = (s > 0) ? s : 1; }
+
+  virtual size_t write(uint8_t ch) {
+    if (ch == '\n') {
+      cursorY += textSize * 8;
+      cursorX = 0;
+    } else if (ch != '\r') {
+      if (cursorX + textSize * 6 > COMPOSITOR_WIDTH) {
+        cursorY += textSize * 8;
+        cursorX = 0;
+      }
+      drawChar(cursorX, cursorY, ch, textColor, textBgColor, textSize);
+      cursorX += textSize * 6;
+    }
+    return 1;
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char ch,
+                uint16_t color, uint16_t bg, uint8_t size) {
+    uint8_t fg = colorIndex(color);
+    uint8_t bgc = colorIndex(bg);
+    bool opaque = (bg != color);
+
+    beginOp();
+    for (int8_t i = 0; i < 6; i++) {
+      uint8_t column = (i < 5) ? glcdfont[ch * 5 + i] : 0;
+      for (int8_t j = 0; j < 8; j++, column >>= 1) {
+        if (column & 0x1) {
+          fill(x + i * size, y + j * size, size, size, fg);
+        } else if (opaque) {
+          fill(x + i * size, y + j * size, size, size, bgc);
+        }
+      }
+    }
+    endOp();
+  }
+
+  // ==================== SPRITE SUPPORT ====================
+
+  // Redirect all drawing into buf, a w x h palette-index surface whose
+  // top-left pixel corresponds to screen position (x, y). Capture drawing
+  // never produces damage. The caller fills buf with COMPOSITOR_TRANSPARENT
+  // first so untouched pixels can be told apart from drawn ones.
+  void beginCapture(uint8_t *buf, int16_t x, int16_t y, int16_t w, int16_t h) {
+    surf = buf;
+    surfX = x;
+    surfY = y;
+    surfW = w;
+    surfH = h;
+    capturing = true;
+  }
+
+  void endCapture() {
+    surf = &compositorFrame[0][0];
+    surfX = surfY = 0;
+    surfW = COMPOSITOR_WIDTH;
+    surfH = COMPOSITOR_HEIGHT;
+    capturing = false;
+  }
+
+  // Raw palette-index spans, used to blit cached sprites. Spans written
+  // between beginSpans() and endSpans() are recorded as a single damage rect.
+  void beginSpans() { beginOp(); }
+  void writeSpan(int16_t x, int16_t y, int16_t w, uint8_t index) { hline(x, y, w, index); }
+  void endSpans() { endOp(); }
+
+private:
+  ILI9488_t3 &panel;
+
+  // Palette: RGB565 value for each index used in the shadow buffer.
+  // Slots below paletteCount have been handed out; a rebuild frees the
+  // ones no longer on screen without moving the rest.
+  uint16_t palette[COMPOSITOR_PALETTE_SIZE];
+  bool paletteLive[COMPOSITOR_PALETTE_SIZE];
+  int paletteCount = 0;
+  uint16_t lastColor = 0;
+  uint8_t lastIndex = 0;
+  uint32_t paletteRebuilds = 0;
+  uint32_t paletteMisses = 0;
+  uint32_t paletteGen = 0;
+
+  // Pending damage (merged, non-overlapping)
+  DamageRect damage[COMPOSITOR_MAX_DAMAGE];
+  int damageCount = 0;
+
+  // Current raster target and the screen position of its top-left pixel
+  uint8_t *surf = &compositorFrame[0][0];
+  int16_t surfX = 0, surfY = 0;
+  int16_t surfW = COMPOSITOR_WIDTH, surfH = COMPOSITOR_HEIGHT;
+  bool capturing = false;
+
+  // Bounding box of pixels changed by the primitive in progress
+  int16_t opX0, opY0, opX1, opY1;
+
+  // Staging buffer for one SPI burst
+  uint16_t tile[COMPOSITOR_TILE_PIXELS];
+
+  // Text state
+  int16_t cursorX = 0, cursorY = 0;
+  uint16_t textColor = 0xFFFF, textBgColor = 0xFFFF;
+  uint8_t textSize = 1;
+
+  // Frame pacing and stats
+  unsigned long frameInterval = COMPOSITOR_FRAME_MS;
+  unsigned long lastFlushTime = 0;
+  uint32_t framesFlushed = 0;
+  uint32_t bytesPushedTotal = 0;
+  uint32_t bytesPushedLastFrame = 0;
+  int regionsLastFrame = 0;
+  uint32_t primitivesDrawn = 0;
+
+  static void swapInt(int16_t &a, int16_t &b) { int16_t t = a; a = b; b = t; }
+
+  uint8_t colorIndex(uint16_t color) {
+    if (paletteCount > 0 && color == lastColor) return lastIndex;
+    for (int i = 0; i < paletteCount; i++) {
+      if (paletteLive[i] && palette[i] == color) return useIndex(i);
+    }
+    if (paletteCount < COMPOSITOR_PALETTE_SIZE) {
+      palette[paletteCount] = color;
+      paletteLive[paletteCount] = true;
+      return useIndex(paletteCount++);
+    }
+
+    // The game uses fewer than 32 distinct colors, so this is a safety net:
+    // free the slots nothing on screen uses any more and take one of those
+    int slot = freeSlot();
+    if (slot < 0 && rebuildPalette()) slot = freeSlot();
+    if (slot >= 0) {
+      palette[slot] = color;
+      paletteLive[slot] = true;
+      return useIndex(slot);
+    }
+
+    // 255 different colors really are on screen; draw the closest one
+    paletteMisses++;
+    return nearestIndex(color);
+  }
+
+  uint8_t useIndex(int i) {
+    lastColor = palette[i];
+    lastIndex = i;
+    return lastIndex;
+  }
+
+  int freeSlot() const {
+    for (int i = 0; i < COMPOSITOR_PALETTE_SIZE; i++) {
+      if (!paletteLive[i]) return i;
+    }
+    return -1;
+  }
+
+  // Mark every index still in the shadow buffer (and in a capture in
+  // progress) and free the rest. The last index handed out stays too, as
+  // a caller may be holding it for a second color lookup (drawChar).
+  // Indices that stay keep their value, so nothing already drawn changes;
+  // the generation bump tells the sprite cache its runs may be stale.
+  // Returns the number of slots freed.
+  int rebuildPalette() {
+    bool used[256];
+    memset(used, 0, sizeof(used));
+    const uint8_t *p = &compositorFrame[0][0];
+    for (uint32_t i = 0; i < sizeof(compositorFrame); i++) used[p[i]] = true;
+    if (capturing) {
+      for (int32_t i = 0; i < (int32_t)surfW * surfH; i++) used[surf[i]] = true;
+    }
+    used[lastIndex] = true;
+
+    int freed = 0;
+    for (int i = 0; i < COMPOSITOR_PALETTE_SIZE; i++) {
+      if (paletteLive[i] && !used[i]) {
+        paletteLive[i] = false;
+        freed++;
+      }
+    }
+    paletteRebuilds++;
+    paletteGen++;
+    return freed;
+  }
+
+  uint8_t nearestIndex(uint16_t color) const {
+    int best = 0;
+    int32_t bestDist = INT32_MAX;
+    for (int i = 0; i < COMPOSITOR_PALETTE_SIZE; i++) {
+      int dr = (int)(palette[i] >> 11) - (color >> 11);
+      int dg = (int)((palette[i] >> 5) & 0x3F) - ((color >> 5) & 0x3F);
+      int db = (int)(palette[i] & 0x1F) - (color & 0x1F);
+      int32_t dist = 4 * dr * dr + dg * dg + 4 * db * db;
+      if (dist < bestDist) {
+        bestDist = dist;
+        best = i;
+      }
+    }
+    return best;
+  }
+
+  // ==================== RASTER CORE ====================
+  //
+  // All primitives write through plot/hline/vline, which translate screen
+  // coordinates into the current target surface (the shadow framebuffer, or
+  // a sprite capture buffer) and clip against it.
+
+  void beginOp() {
+    primitivesDrawn++;
+    opX0 = surfW;
+    opY0 = surfH;
+    opX1 = -1;
+    opY1 = -1;
+  }
+
+  void endOp() {
+    if (!capturing && opX1 >= opX0) {
+      addDamage(opX0, opY0, opX1, opY1);
+    }
+  }
+
+  inline void touch(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    if (x0 < opX0) opX0 = x0;
+    if (y0 < opY0) opY0 = y0;
+    if (x1 > opX1) opX1 = x1;
+    if (y1 > opY1) opY1 = y1;
+  }
+
+  inline void plot(int16_t x, int16_t y, uint8_t c) {
+    x -= surfX;
+    y -= surfY;
+    if (x < 0 || y < 0 || x >= surfW || y >= surfH) return;
+    uint8_t *p = surf + (int32_t)y * surfW + x;
+    if (*p != c) {
+      *p = c;
+      touch(x, y, x, y);
+    }
+  }
+
+  void hline(int16_t x, int16_t y, int16_t w, uint8_t c) {
+    x -= surfX;
+    y -= surfY;
+    if (y < 0 || y >= surfH || w <= 0) return;
+    int16_t x1 = x + w - 1;
+    if (x < 0) x = 0;
+    if (x1 >= surfW) x1 = surfW - 1;
+    if (x > x1) return;
+
+    uint8_t *row = surf + (int32_t)y * surfW;
+    int16_t first = -1, last = -1;
+    for (int16_t i = x; i <= x1; i++) {
+      if (row[i] != c) {
+        row[i] = c;
+        if (first < 0) first = i;
+        last = i;
+      }
+    }
+    if (first >= 0) touch(first, y, last, y);
+  }
+
+  void vline(int16_t x, int16_t y, int16_t h, uint8_t c) {
+    x -= surfX;
+    y -= surfY;
+    if (x < 0 || x >= surfW || h <= 0) return;
+    int16_t y1 = y + h - 1;
+    if (y < 0) y = 0;
+    if (y1 >= surfH) y1 = surfH - 1;
+    if (y > y1) return;
+
+    uint8_t *p = surf + (int32_t)y * surfW + x;
+    int16_t first = -1, last = -1;
+    for (int16_t j = y; j <= y1; j++, p += surfW) {
+      if (*p != c) {
+        *p = c;
+        if (first < 0) first = j;
+        last = j;
+      }
+    }
+    if (first >= 0) touch(x, first, x, last);
+  }
+
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t c) {
+    if (w <= 0 || h <= 0) return;
+    int16_t y1 = y + h - 1;
+    if (y < surfY) y = surfY;
+    if (y1 >= surfY + surfH) y1 = surfY + surfH - 1;
+    for (int16_t j = y; j <= y1; j++) {
+      hline(x, j, w, c);
+    }
+  }
+
+  void line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t c) {
+    if (y0 == y1) {
+      if (x1 > x0) hline(x0, y0, x1 - x0 + 1, c);
+      else hline(x1, y0, x0 - x1 + 1, c);
+      return;
+    }
+    if (x0 == x1) {
+      if (y1 > y0) vline(x0, y0, y1 - y0 + 1, c);
+      else vline(x0, y1, y0 - y1 + 1, c);
+      return;
+    }
+
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      swapInt(x0, y0);
+      swapInt(x1, y1);
+    }
+    if (x0 > x1) {
+      swapInt(x0, x1);
+      swapInt(y0, y1);
+    }
+
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = (y0 < y1) ? 1 : -1;
+
+    for (; x0 <= x1; x0++) {
+      if (steep) plot(y0, x0, c);
+      else plot(x0, y0, c);
+      err -= dy;
+      if (err < 0) {
+        y0 += ystep;
+        err += dx;
+      }
+    }
+  }
+
+  // ==================== DAMAGE TRACKING ====================
+
+  static bool touches(const DamageRect &a, const DamageRect &b) {
+    return a.x0 <= b.x1 + 1 && b.x0 <= a.x1 + 1 &&
+           a.y0 <= b.y1 + 1 && b.y0 <= a.y1 + 1;
+  }
+
+  static void merge(DamageRect &into, const DamageRect &r) {
+    if (r.x0 < into.x0) into.x0 = r.x0;
+    if (r.y0 < into.y0) into.y0 = r.y0;
+    if (r.x1 > into.x1) into.x1 = r.x1;
+    if (r.y1 > into.y1) into.y1 = r.y1;
+  }
+
+  static int32_t area(const DamageRect &r) {
+    return (int32_t)(r.x1 - r.x0 + 1) * (r.y1 - r.y0 + 1);
+  }
+
+  void addDamage(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    DamageRect r = { x0, y0, x1, y1 };
+
+    // Absorb every pending rect that overlaps or abuts the new one. Growing
+    // r can make it reach rects we already passed, so rescan until stable.
+    bool merged = true;
+    while (merged) {
+      merged = false;
+      for (int i = 0; i < damageCount; i++) {
+        if (touches(r, damage[i])) {
+          merge(r, damage[i]);
+          damage[i] = damage[--damageCount];
+          merged = true;
+          break;
+        }
+      }
+    }
+
+    if (damageCount < COMPOSITOR_MAX_DAMAGE) {
+      damage[damageCount++] = r;
+      return;
+    }
+
+    // List is full: fold into whichever rect grows the least, then re-add
+    // the result so it can absorb anything it now overlaps.
+    int best = 0;
+    int32_t bestGrowth = INT32_MAX;
+    for (int i = 0; i < damageCount; i++) {
+      DamageRect u = damage[i];
+      merge(u, r);
+      int32_t growth = area(u) - area(damage[i]);
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    merge(r, damage[best]);
+    damage[best] = damage[--damageCount];
+    addDamage(r.x0, r.y0, r.x1, r.y1);
+  }
+
+  // Convert one damaged region to RGB565 band by band and push it.
+  // Returns the number of bytes sent to the panel.
+  uint32_t pushRegion(const DamageRect &r) {
+    int16_t w = r.x1 - r.x0 + 1;
+    int16_t bandRows = COMPOSITOR_TILE_PIXELS / w;
+    if (bandRows < 1) bandRows = 1;
+    uint32_t bytes = 0;
+
+    for (int16_t y = r.y0; y <= r.y1; y += bandRows) {
+      int16_t rows = min((int)bandRows, (int)(r.y1 - y + 1));
+      uint16_t *out = tile;
+      for (int16_t j = 0; j < rows; j++) {
+        const uint8_t *src = &compositorFrame[y + j][r.x0];
+        for (int16_t i = 0; i < w; i++) {
+          *out++ = palette[src[i]];
+        }
+      }
+      panel.writeRect(r.x0, y, w, rows, tile);
+      bytes += COMPOSITOR_WINDOW_OVERHEAD + (uint32_t)w * rows * COMPOSITOR_BYTES_PER_PIXEL;
+    }
+    return bytes;
+  }
+};
+
+#endif // COMPOSITOR_H
@@ -0,0 +1,469 @@
+/*
+ * entities.h - Pooled game targets for BONK REV8.0 and BONK DOS
+ *
+ * Every tappable thing on the playfield (regular characters, specials)
+ * lives in one fixed-size pool, stored as one array per field so a pass
+ * over positions doesn't drag timers and links through the cache with it.
+ *
+ *   - Spawn and despawn are O(1): ids come off a free stack, and live ids
+ *     sit in a dense list with back-pointers so removal is a swap.
+ *   - A uniform grid keeps, per cell, a bit for every entity whose hit
+ *     box covers any of that cell. A tap reads the one cell it lands in
+ *     and tests only the entities set there. Cells are as fine as
+ *     ENTITY_GRID_CELLS allows, down to a quarter hit box, so a full
+ *     field still puts only a few entities in each.
+ *   - Placement tries one uniform pick, then rules out every cell where a
+ *     top-left would put the new box within 'gap' of a live one and picks
+ *     from the cells left, which are clear by construction. On a field
+ *     too full for that it searches the few lines a clear spot must touch.
+ *   - A despawned entity can linger as a "ghost" that still takes taps
+ *     until its own grace deadline. Ghosts are reclaimed oldest first.
+ *
+ * Shared by the Teensy sketch (C++) and the DOS port (C89, Turbo C and
+ * DJGPP), so it is plain C with everything static. All times are
+ * millisecond counters and comparisons are wrap-safe.
+ */
+
+#ifndef ENTITIES_H
+#define ENTITIES_H
+
+/* Pool capacity, at most 254 so an id fits a byte */
+#ifndef ENTITY_MAX
+#define ENTITY_MAX 48
+#endif
+
+/* Grid cells available to entityInit(). A bigger playfield than this
+ * allows just gets coarser cells. */
+#ifndef ENTITY_GRID_CELLS
+#define ENTITY_GRID_CELLS 96
+#endif
+
+/* Kinds are small integers chosen by the game. Lower kinds win when a tap
+ * lands on more than one entity. */
+#define ENTITY_KINDS       4
+
+/* Entity ids as bits, 32 to an unsigned long */
+#define ENTITY_WORDS       ((ENTITY_MAX + 31) / 32)
+#define ENTITY_WORD(id)    ((id) >> 5)
+#define ENTITY_BIT(id)     (1UL << ((id) & 31))
+
+#define ENTITY_NONE        0xFF
+
+#if defined(__cplusplus) || (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#define ENTITY_FN static inline
+#elif defined(__GNUC__)
+#define ENTITY_FN static __inline__
+#else
+#define ENTITY_FN static
+#endif
+
+typedef unsigned char EntityId;
+
+/* Returns lo <= r < hi, from whatever generator the game already uses */
+typedef int (*EntityRandom)(int lo, int hi);
+
+enum EntityState {
+  ENTITY_FREE,
+  ENTITY_LIVE,
+  ENTITY_GHOST
+};
+
+typedef struct {
+  /* Per entity. (x, y) is the top-left of a size x size box, and a tap
+   * counts anywhere within 'pad' pixels of it. */
+  int x[ENTITY_MAX];
+  int y[ENTITY_MAX];
+  unsigned char size[ENTITY_MAX];
+  unsigned char pad[ENTITY_MAX];
+  unsigned char kind[ENTITY_MAX];
+  unsigned char state[ENTITY_MAX];
+  unsigned long expiresAt[ENTITY_MAX];   /* Set by the game, not used here */
+  unsigned long graceUntil[ENTITY_MAX];  /* Ghosts take taps until this */
+
+  /* Dense list of live ids. live[liveSlot[id]] == id. */
+  EntityId live[ENTITY_MAX];
+  unsigned char liveSlot[ENTITY_MAX];
+  int liveCount;
+  int kindCount[ENTITY_KINDS];
+
+  /* Unused ids */
+  EntityId freeIds[ENTITY_MAX];
+  int freeCount;
+
+  /* Ghosts, oldest first */
+  EntityId ghostNext[ENTITY_MAX];
+  EntityId ghostPrev[ENTITY_MAX];
+  EntityId ghostHead, ghostTail;
+
+  /* Grid: per cell a bit for every entity (live or ghost) whose hit box
+   * covers any of the cell, and the bits of the live ones */
+  unsigned long cellBits[ENTITY_GRID_CELLS][ENTITY_WORDS];
+  unsigned long liveBits[ENTITY_WORDS];
+  int cellSize, cols, rows;
+} EntityPool;
+
+/*==================== GRID ====================*/
+
+ENTITY_FN int entityCol(const EntityPool *p, int x) {
+  if (x < 0) return 0;
+  x /= p->cellSize;
+  return x < p->cols ? x : p->cols - 1;
+}
+
+ENTITY_FN int entityRow(const EntityPool *p, int y) {
+  if (y < 0) return 0;
+  y /= p->cellSize;
+  return y < p->rows ? y : p->rows - 1;
+}
+
+/* Index of the lowest set bit of a non-zero word */
+ENTITY_FN int entityLowBit(unsigned long w) {
+#if defined(__GNUC__)
+  return __builtin_ctzl(w);
+#else
+  int b = 0;
+  while (!(w & 1)) {
+    w >>= 1;
+    b++;
+  }
+  return b;
+#endif
+}
+
+/* Set or clear an entity's bit in every cell its hit box covers */
+ENTITY_FN void entityFile(EntityPool *p, EntityId id, int on) {
+  int x = p->x[id], y = p->y[id], s = p->size[id], pad = p->pad[id];
+  int c1 = entityCol(p, x - pad), c2 = entityCol(p, x + s + pad);
+  int r1 = entityRow(p, y - pad), r2 = entityRow(p, y + s + pad);
+  int w = ENTITY_WORD(id), r, c;
+  unsigned long bit = ENTITY_BIT(id);
+
+  for (r = r1; r <= r2; r++) {
+    for (c = c1; c <= c2; c++) {
+      if (on) p->cellBits[r * p->cols + c][w] |= bit;
+      else p->cellBits[r * p->cols + c][w] &= ~bit;
+    }
+  }
+}
+
+ENTITY_FN void entityLink(EntityPool *p, EntityId id) {
+  entityFile(p, id, 1);
+}
+
+ENTITY_FN void entityUnlink(EntityPool *p, EntityId id) {
+  entityFile(p, id, 0);
+}
+
+/*==================== POOL ====================*/
+
+/* Forget every entity, keeping the grid geometry */
+ENTITY_FN void entityReset(EntityPool *p) {
+  int i;
+
+  for (i = 0; i < ENTITY_MAX; i++) {
+    p->state[i] = ENTITY_FREE;
+    p->freeIds[i] = (EntityId)(ENTITY_MAX - 1 - i);  /* Hand out id 0 first */
+  }
+  p->freeCount = ENTITY_MAX;
+  p->liveCount = 0;
+  for (i = 0; i < ENTITY_KINDS; i++) p->kindCount[i] = 0;
+  p->ghostHead = p->ghostTail = ENTITY_NONE;
+  for (i = 0; i < ENTITY_WORDS; i++) p->liveBits[i] = 0;
+  for (i = 0; i < ENTITY_GRID_CELLS; i++) {
+    int w;
+    for (w = 0; w < ENTITY_WORDS; w++) p->cellBits[i][w] = 0;
+  }
+}
+
+/* A width x height playfield where hit boxes (size + 2 * pad) are usually
+ * at most 'reach' across. Cells are as small as ENTITY_GRID_CELLS allows,
+ * but no smaller than a quarter of that, so filing an entity touches at
+ * most 5 x 5 cells. Bigger boxes still work, they just cover more. */
+ENTITY_FN void entityInit(EntityPool *p, int width, int height, int reach) {
+  int cellSize = reach > 3 ? reach / 4 : 1;
+  for (;;) {
+    p->cols = (width + cellSize - 1) / cellSize;
+    p->rows = (height + cellSize - 1) / cellSize;
+    if (p->cols * p->rows <= ENTITY_GRID_CELLS) break;
+    cellSize++;
+  }
+  p->cellSize = cellSize;
+  entityReset(p);
+}
+
+ENTITY_FN void entityUnghost(EntityPool *p, EntityId id) {
+  EntityId prev = p->ghostPrev[id];
+  EntityId next = p->ghostNext[id];
+
+  if (prev != ENTITY_NONE) p->ghostNext[prev] = next;
+  else p->ghostHead = next;
+  if (next != ENTITY_NONE) p->ghostPrev[next] = prev;
+  else p->ghostTail = prev;
+}
+
+ENTITY_FN void entityUnlive(EntityPool *p, EntityId id) {
+  int slot = p->liveSlot[id];
+  EntityId last = p->live[--p->liveCount];
+
+  p->live[slot] = last;
+  p->liveSlot[last] = (unsigned char)slot;
+  p->kindCount[p->kind[id]]--;
+  p->liveBits[ENTITY_WORD(id)] &= ~ENTITY_BIT(id);
+}
+
+/* Drop an entity outright, live or ghost */
+ENTITY_FN void entityRelease(EntityPool *p, EntityId id) {
+  if (id == ENTITY_NONE || p->state[id] == ENTITY_FREE) return;
+  if (p->state[id] == ENTITY_LIVE) entityUnlive(p, id);
+  else entityUnghost(p, id);
+  entityUnlink(p, id);
+  p->state[id] = ENTITY_FREE;
+  p->freeIds[p->freeCount++] = id;
+}
+
+/* Reclaim ghosts whose grace has run out */
+ENTITY_FN void entityReap(EntityPool *p, unsigned long now) {
+  while (p->ghostHead != ENTITY_NONE &&
+         (long)(now - p->graceUntil[p->ghostHead]) >= 0) {
+    entityRelease(p, p->ghostHead);
+  }
+}
+
+/* Returns the new id, or ENTITY_NONE if the pool is full of live ones.
+ * When only ghosts are left, the oldest one makes room. */
+ENTITY_FN EntityId entitySpawn(EntityPool *p, int kind, int x, int y, int size, int pad,
+                               unsigned long expiresAt) {
+  EntityId id;
+
+  if (p->freeCount == 0) {
+    if (p->ghostHead == ENTITY_NONE) return ENTITY_NONE;
+    entityRelease(p, p->ghostHead);
+  }
+  id = p->freeIds[--p->freeCount];
+
+  p->x[id] = x;
+  p->y[id] = y;
+  p->size[id] = (unsigned char)size;
+  p->pad[id] = (unsigned char)pad;
+  p->kind[id] = (unsigned char)kind;
+  p->state[id] = ENTITY_LIVE;
+  p->expiresAt[id] = expiresAt;
+  p->graceUntil[id] = 0;
+
+  p->liveSlot[id] = (unsigned char)p->liveCount;
+  p->live[p->liveCount++] = id;
+  p->kindCount[kind]++;
+  p->liveBits[ENTITY_WORD(id)] |= ENTITY_BIT(id);
+  entityLink(p, id);
+  return id;
+}
+
+/* Take a live entity off the field. With grace > 0 it stays hittable as
+ * a ghost until now + grace. Walk live[] backwards when despawning from
+ * inside a loop over it - the last entry moves into the freed slot. */
+ENTITY_FN void entityDespawn(EntityPool *p, EntityId id, unsigned long now,
+                             unsigned long grace) {
+  if (id == ENTITY_NONE || p->state[id] != ENTITY_LIVE) return;
+  entityReap(p, now);
+  if (grace == 0) {
+    entityRelease(p, id);
+    return;
+  }
+
+  entityUnlive(p, id);
+  p->state[id] = ENTITY_GHOST;
+  p->graceUntil[id] = now + grace;
+  p->ghostNext[id] = ENTITY_NONE;
+  p->ghostPrev[id] = p->ghostTail;
+  if (p->ghostTail != ENTITY_NONE) p->ghostNext[p->ghostTail] = id;
+  else p->ghostHead = id;
+  p->ghostTail = id;
+}
+
+ENTITY_FN void entityMove(EntityPool *p, EntityId id, int x, int y) {
+  entityUnlink(p, id);
+  p->x[id] = x;
+  p->y[id] = y;
+  entityLink(p, id);
+}
+
+/*==================== QUERIES ====================*/
+
+/* Live entities whose box touches the rectangle (x1, y1) - (x2, y2),
+ * edges included. Fills up to 'max' ids into 'out' (which may be NULL)
+ * and returns how many there are in total. */
+ENTITY_FN int entityOverlapping(const EntityPool *p, int x1, int y1, int x2, int y2,
+                                EntityId *out, int max) {
+  /* Anything touching the rectangle is filed in a cell it covers */
+  int c1 = entityCol(p, x1), c2 = entityCol(p, x2);
+  int r1 = entityRow(p, y1), r2 = entityRow(p, y2);
+  unsigned long bits[ENTITY_WORDS];
+  int r, c, w, found = 0;
+
+  for (w = 0; w < ENTITY_WORDS; w++) bits[w] = 0;
+  for (r = r1; r <= r2; r++) {
+    for (c = c1; c <= c2; c++) {
+      for (w = 0; w < ENTITY_WORDS; w++) bits[w] |= p->cellBits[r * p->cols + c][w];
+    }
+  }
+
+  for (w = 0; w < ENTITY_WORDS; w++) {
+    unsigned long set = bits[w] & p->liveBits[w];
+    while (set) {
+      EntityId id = (EntityId)(w * 32 + entityLowBit(set));
+      set &= set - 1;
+      if (p->x[id] > x2 || p->x[id] + p->size[id] < x1) continue;
+      if (p->y[id] > y2 || p->y[id] + p->size[id] < y1) continue;
+      if (out && found < max) out[found] = id;
+      found++;
+    }
+  }
+  return found;
+}
+
+/* The entity a tap at (tx, ty) lands on: live ones before ghosts still in
+ * their grace period, then the lowest kind, then the nearest centre
+ * (then the lowest id). Returns ENTITY_NONE on a miss. */
+ENTITY_FN EntityId entityHit(EntityPool *p, int tx, int ty, unsigned long now) {
+  const unsigned long *cell = p->cellBits[entityRow(p, ty) * p->cols + entityCol(p, tx)];
+  EntityId best = ENTITY_NONE;
+  int bestRank = 0;
+  long bestDist = 0;
+  int w;
+
+  entityReap(p, now);
+  for (w = 0; w < ENTITY_WORDS; w++) {
+    unsigned long set = cell[w];
+    while (set) {
+      EntityId id = (EntityId)(w * 32 + entityLowBit(set));
+      int x = p->x[id], y = p->y[id], s = p->size[id], pad = p->pad[id];
+      int rank;
+      long dx, dy, dist;
+
+      set &= set - 1;
+      if (tx < x - pad || tx > x + s + pad || ty < y - pad || ty > y + s + pad) continue;
+      if (p->state[id] == ENTITY_GHOST && (long)(now - p->graceUntil[id]) >= 0) continue;
+
+      rank = p->kind[id] + (p->state[id] == ENTITY_GHOST ? ENTITY_KINDS : 0);
+      dx = 2L * tx - (2L * x + s);
+      dy = 2L * ty - (2L * y + s);
+      dist = dx * dx + dy * dy;
+      if (best == ENTITY_NONE || rank < bestRank ||
+          (rank == bestRank && (dist < bestDist || (dist == bestDist && id < best)))) {
+        best = id;
+        bestRank = rank;
+        bestDist = dist;
+      }
+    }
+  }
+  return best;
+}
+
+/* Nonzero if a size x size box at (x, y) comes within 'gap' of anything live */
+ENTITY_FN int entityCrowded(const EntityPool *p, int size, int gap, int x, int y) {
+  return entityOverlapping(p, x - gap, y - gap, x + size + gap, y + size + gap, 0, 0) != 0;
+}
+
+/* Pick a top-left for a size x size entity in [x1, x2) x [y1, y2) that
+ * keeps 'gap' pixels from everything live. The first candidate is a plain
+ * uniform pick (two calls to rnd), so an empty field places exactly as
+ * before. If that one is crowded, every cell where a top-left could come
+ * within 'gap' of a live box is ruled out and the spot is drawn from the
+ * cells left, which are clear by construction. If no whole cell is clear,
+ * a clear spot can still slide left and up until it meets x1, y1 or the
+ * far edge of a live box plus gap, so those lines are searched in full.
+ * Returns 1 with a clear spot, or 0 if there is none, leaving the uniform
+ * pick in *outX, *outY anyway. */
+ENTITY_FN int entityPlace(const EntityPool *p, int size, int gap,
+                          int x1, int y1, int x2, int y2, EntityRandom rnd,
+                          int *outX, int *outY) {
+  unsigned char blocked[ENTITY_GRID_CELLS];
+  unsigned char freeCells[ENTITY_GRID_CELLS];
+  EntityId inCol[ENTITY_MAX];
+  int cells = p->cols * p->rows;
+  int n = p->liveCount + 1;
+  int freeCount = 0;
+  int sx, sy, i, j, r, c;
+
+  if (x2 <= x1) x2 = x1 + 1;
+  if (y2 <= y1) y2 = y1 + 1;
+
+  *outX = rnd(x1, x2);
+  *outY = rnd(y1, y2);
+  if (!entityCrowded(p, size, gap, *outX, *outY)) return 1;
+
+  /* A top-left from size + gap before a live box to gap after it is too
+   * close. Mark every cell those ranges touch. */
+  for (i = 0; i < cells; i++) blocked[i] = 0;
+  for (i = 0; i < p->liveCount; i++) {
+    EntityId id = p->live[i];
+    int c1 = entityCol(p, p->x[id] - size - gap), c2 = entityCol(p, p->x[id] + p->size[id] + gap);
+    int r1 = entityRow(p, p->y[id] - size - gap), r2 = entityRow(p, p->y[id] + p->size[id] + gap);
+    for (r = r1; r <= r2; r++) {
+      for (c = c1; c <= c2; c++) blocked[r * p->cols + c] = 1;
+    }
+  }
+
+  /* The rest, clipped to the allowed range */
+  for (i = 0; i < cells; i++) {
+    int cx = (i % p->cols) * p->cellSize, cy = (i / p->cols) * p->cellSize;
+    if (!blocked[i] && cx < x2 && cx + p->cellSize > x1 &&
+        cy < y2 && cy + p->cellSize > y1) {
+      freeCells[freeCount++] = (unsigned char)i;
+    }
+  }
+
+  if (freeCount > 0) {
+    int cx1, cy1, cx2, cy2;
+
+    c = freeCells[freeCount > 1 ? rnd(0, freeCount) : 0];
+    cx1 = (c % p->cols) * p->cellSize;
+    cy1 = (c / p->cols) * p->cellSize;
+    cx2 = cx1 + p->cellSize;
+    cy2 = cy1 + p->cellSize;
+    if (cx1 < x1) cx1 = x1;
+    if (cy1 < y1) cy1 = y1;
+    if (cx2 > x2) cx2 = x2;
+    if (cy2 > y2) cy2 = y2;
+    *outX = rnd(cx1, cx2);
+    *outY = rnd(cy1, cy2);
+    return 1;
+  }
+
+  /* Left edges at x1 or just past a live box. Each one only meets the
+   * boxes that overlap it in x, so the tops to try are y1 and just below
+   * each of those. Start from a random pair so a crowded field doesn't
+   * fill from one corner. */
+  sx = rnd(0, n);
+  sy = rnd(0, n);
+  for (i = 0; i < n; i++) {
+    int ix = (sx + i) % n;
+    int x = ix < p->liveCount ? p->x[p->live[ix]] + p->size[p->live[ix]] + gap + 1 : x1;
+    int k = 0;
+
+    if (x < x1 || x >= x2) continue;
+    for (j = 0; j < p->liveCount; j++) {
+      EntityId id = p->live[j];
+      if (x >= p->x[id] - size - gap && x <= p->x[id] + p->size[id] + gap) inCol[k++] = id;
+    }
+    for (j = 0; j <= k; j++) {
+      int iy = (sy + j) % (k + 1);
+      int y = iy < k ? p->y[inCol[iy]] + p->size[inCol[iy]] + gap + 1 : y1;
+      int m;
+
+      if (y < y1 || y >= y2) continue;
+      for (m = 0; m < k; m++) {
+        EntityId id = inCol[m];
+        if (y >= p->y[id] - size - gap && y <= p->y[id] + p->size[id] + gap) break;
+      }
+      if (m == k) {
+        *outX = x;
+        *outY = y;
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+#endif /* ENTITIES_H */
@@ -0,0 +1,252 @@
+/*
+ * sprite_cache.h - Size-keyed sprite cache for BONK REV8.0 Dragons
+ *
+ * Characters are still designed as procedural drawings (fillCircle,
+ * fillTriangle, ...), but each (character, size) pair is only rasterized
+ * once: the first time it is needed the drawing is captured through the
+ * compositor into a scratch buffer, trimmed to its bounding box and stored
+ * as run-length encoded palette indices. Every later spawn is a single
+ * rectangular blit of those runs.
+ *
+ * Because the capture runs the exact same primitives into the exact same
+ * palette, a blit is pixel-identical to the procedural drawing. Pixels the
+ * drawing never touched stay transparent, so whatever is underneath shows
+ * through just like before.
+ *
+ * Memory is bounded by SPRITE_CACHE_BUDGET; the least recently used entry
+ * is evicted when a new one does not fit.
+ */
+
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <Arduino.h>
+#include "compositor.h"
+
+// Cache limits
+#define SPRITE_CACHE_MAX_ENTRIES  48
+#define SPRITE_CACHE_BUDGET       (48 * 1024)
+
+// Largest character size the cache will accept, and how far outside its
+// nominal size x size box a drawing may reach (ears, tails, sparkles...)
+#define SPRITE_MAX_SIZE           64
+#define SPRITE_CAPTURE_PAD        32
+#define SPRITE_CAPTURE_DIM        (SPRITE_MAX_SIZE + 2 * SPRITE_CAPTURE_PAD)
+
+// Draws sprite 'kind' procedurally with its top-left anchor at (x, y)
+typedef void (*SpriteRasterFn)(uint8_t kind, int x, int y);
+
+struct SpriteEntry {
+  uint8_t kind;
+  uint8_t size;
+  int8_t offX, offY;     // Top-left of the trimmed bitmap relative to the anchor
+  uint8_t w, h;          // Trimmed bitmap size (0 x 0 if nothing was drawn)
+  uint16_t bytes;        // Length of rle
+  uint32_t lastUse;      // LRU stamp
+  uint8_t *rle;          // Per row: (run length, palette index) pairs
+};
+
+// Scratch surface used while rasterizing a cache miss
+static uint8_t spriteCaptureBuf[SPRITE_CAPTURE_DIM * SPRITE_CAPTURE_DIM];
+
+class SpriteCache {
+public:
+  SpriteCache(Compositor &gfx, SpriteRasterFn raster) : gfx(gfx), raster(raster) {}
+
+  // Draw sprite 'kind' at 'size' with its anchor at (x, y). The raster
+  // callback must already see 'size' as the current character size.
+  void draw(uint8_t kind, uint8_t size, int x, int y) {
+    if (size > SPRITE_MAX_SIZE) {
+      // Too big to cache - draw it the slow way
+      raster(kind, x, y);
+      return;
+    }
+
+    // Cached runs are palette indices; a palette rebuild may have reused them
+    if (gfx.paletteGeneration() != paletteSeen) {
+      clear();
+      paletteSeen = gfx.paletteGeneration();
+    }
+
+    SpriteEntry *e = find(kind, size);
+    if (e) {
+      hitCount++;
+    } else {
+      missCount++;
+      e = rasterize(kind, size, x, y);
+      if (!e) {
+        // Out of entries/memory even after eviction
+        raster(kind, x, y);
+        return;
+      }
+    }
+    e->lastUse = ++useClock;
+    blit(*e, x, y);
+
+    // A rebuild during the capture kept the new sprite's colors but not
+    // necessarily anyone else's
+    if (gfx.paletteGeneration() != paletteSeen) {
+      clear();
+      paletteSeen = gfx.paletteGeneration();
+    }
+  }
+
+  // Drop every cached sprite
+  void clear() {
+    for (int i = 0; i < entryCount; i++) {
+      free(entries[i].rle);
+    }
+    entryCount = 0;
+    bytesUsed = 0;
+  }
+
+  // Stats
+  uint32_t hits() const { return hitCount; }
+  uint32_t misses() const { return missCount; }
+  uint32_t evictions() const { return evictCount; }
+  uint32_t memoryUsed() const { return bytesUsed; }
+  int spriteCount() const { return entryCount; }
+
+  // Hit rate in percent (0-100)
+  uint8_t hitRate() const {
+    uint32_t total = hitCount + missCount;
+    return total ? (uint8_t)(hitCount * 100 / total) : 0;
+  }
+
+private:
+  Compositor &gfx;
+  SpriteRasterFn raster;
+
+  SpriteEntry entries[SPRITE_CACHE_MAX_ENTRIES];
+  int entryCount = 0;
+  uint32_t bytesUsed = 0;
+  uint32_t useClock = 0;
+  uint32_t paletteSeen = 0;
+
+  uint32_t hitCount = 0;
+  uint32_t missCount = 0;
+  uint32_t evictCount = 0;
+
+  SpriteEntry *find(uint8_t kind, uint8_t size) {
+    for (int i = 0; i < entryCount; i++) {
+      if (entries[i].kind == kind && entries[i].size == size) {
+        return &entries[i];
+      }
+    }
+    return NULL;
+  }
+
+  void evictLeastRecent() {
+    int victim = 0;
+    for (int i = 1; i < entryCount; i++) {
+      if (entries[i].lastUse < entries[victim].lastUse) {
+        victim = i;
+      }
+    }
+    free(entries[victim].rle);
+    bytesUsed -= entries[victim].bytes;
+    entries[victim] = entries[--entryCount];
+    evictCount++;
+  }
+
+  // Capture the procedural drawing into the scratch buffer and encode it
+  SpriteEntry *rasterize(uint8_t kind, uint8_t size, int x, int y) {
+    memset(spriteCaptureBuf, COMPOSITOR_TRANSPARENT, sizeof(spriteCaptureBuf));
+    gfx.beginCapture(spriteCaptureBuf, x - SPRITE_CAPTURE_PAD, y - SPRITE_CAPTURE_PAD,
+                     SPRITE_CAPTURE_DIM, SPRITE_CAPTURE_DIM);
+    raster(kind, x, y);
+    gfx.endCapture();
+
+    // Trim to the drawn pixels
+    int minX = SPRITE_CAPTURE_DIM, minY = SPRITE_CAPTURE_DIM, maxX = -1, maxY = -1;
+    for (int j = 0; j < SPRITE_CAPTURE_DIM; j++) {
+      const uint8_t *row = &spriteCaptureBuf[j * SPRITE_CAPTURE_DIM];
+      for (int i = 0; i < SPRITE_CAPTURE_DIM; i++) {
+        if (row[i] != COMPOSITOR_TRANSPARENT) {
+          if (i < minX) minX = i;
+          if (i > maxX) maxX = i;
+          if (j < minY) minY = j;
+          maxY = j;
+        }
+      }
+    }
+
+    SpriteEntry e;
+    e.kind = kind;
+    e.size = size;
+    e.rle = NULL;
+    e.bytes = 0;
+    if (maxX < 0) {
+      e.offX = e.offY = 0;
+      e.w = e.h = 0;
+    } else {
+      e.offX = minX - SPRITE_CAPTURE_PAD;
+      e.offY = minY - SPRITE_CAPTURE_PAD;
+      e.w = maxX - minX + 1;
+      e.h = maxY - minY + 1;
+      e.bytes = encode(minX, minY, e.w, e.h, NULL);
+    }
+
+    while (entryCount > 0 &&
+           (entryCount >= SPRITE_CACHE_MAX_ENTRIES || bytesUsed + e.bytes > SPRITE_CACHE_BUDGET)) {
+      evictLeastRecent();
+    }
+    if (e.bytes > SPRITE_CACHE_BUDGET) return NULL;
+
+    if (e.bytes > 0) {
+      e.rle = (uint8_t *)malloc(e.bytes);
+      if (!e.rle) return NULL;
+      encode(minX, minY, e.w, e.h, e.rle);
+    }
+
+    bytesUsed += e.bytes;
+    entries[entryCount] = e;
+    return &entries[entryCount++];
+  }
+
+  // Encode a region of the capture buffer as per-row runs. With out == NULL
+  // it only measures. Runs never cross rows, so a blit can clip per row.
+  uint16_t encode(int x0, int y0, int w, int h, uint8_t *out) {
+    uint16_t n = 0;
+    for (int j = 0; j < h; j++) {
+      const uint8_t *row = &spriteCaptureBuf[(y0 + j) * SPRITE_CAPTURE_DIM + x0];
+      int i = 0;
+      while (i < w) {
+        uint8_t index = row[i];
+        int run = 1;
+        while (i + run < w && row[i + run] == index && run < 255) run++;
+        if (out) {
+          out[n] = run;
+          out[n + 1] = index;
+        }
+        n += 2;
+        i += run;
+      }
+    }
+    return n;
+  }
+
+  void blit(const SpriteEntry &e, int x, int y) {
+    if (e.w == 0) return;
+    const uint8_t *p = e.rle;
+    int left = x + e.offX;
+    int top = y + e.offY;
+
+    gfx.beginSpans();
+    for (int j = 0; j < e.h; j++) {
+      int i = 0;
+      while (i < e.w) {
+        uint8_t run = p[0];
+        uint8_t index = p[1];
+        p += 2;
+        if (index != COMPOSITOR_TRANSPARENT) {
+          gfx.writeSpan(left + i, top + j, run, index);
+        }
+        i += run;
+      }
+    }
+    gfx.endSpans();
+  }
+};
+
+#endif // SPRITE_CACHE_H
@@ -0,0 +1,193 @@
+/*
+ * telemetry.h - Binary event log for BONK REV8.0
+ *
+ * Replaces the Serial.print() tracing that used to sit on the touch, score
+ * and menu paths. Formatting text and pushing it through a 9600 baud port
+ * took longer than the work being traced; logging an event here is a copy
+ * of a few words into a fixed RAM ring, with no formatting and no waiting.
+ *
+ * drain() moves whole records to the port, only as many as the port says
+ * it has room for with availableForWrite(), so it never blocks either. In
+ * the background (TELEMETRY_BACKGROUND 1) the sketch drains on every loop()
+ * pass; otherwise the ring only empties after the host asks for it by
+ * sending any byte. When the ring is full new events are dropped and
+ * counted, and a TELEM_DROPPED record reports how many once there is room.
+ *
+ * Wire format, 16 bytes per record, little-endian:
+ *
+ *   0   0xB5 sync        4   time, micros() when the event happened
+ *   1   type             8   v1
+ *   2   a                12  v2
+ *   3   check, chosen so all 16 bytes sum to 0 mod 256
+ *
+ * host_sim/tools/telemetry.py decodes a capture into latency histograms
+ * and per-handler time.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+// Events held in RAM, must be a power of two
+#ifndef TELEMETRY_EVENTS
+#define TELEMETRY_EVENTS 256
+#endif
+
+// 1 = drain every loop() pass, 0 = only when the host sends a byte
+#ifndef TELEMETRY_BACKGROUND
+#define TELEMETRY_BACKGROUND 1
+#endif
+
+#define TELEMETRY_SYNC         0xB5
+#define TELEMETRY_RECORD_BYTES 16
+
+// Set on TELEM_HIT when the tap landed in an EASY mode grace period
+#define TELEM_GRACE 0x80
+
+// Pack a screen position into one value
+#define TELEM_XY(x, y) ((uint32_t)(uint16_t)(x) | ((uint32_t)(uint16_t)(y) << 16))
+
+enum TelemetryType {
+  TELEM_BOOT = 1,     // v1 = ring size
+  TELEM_STATE,        // a = new GameState
+  TELEM_MENU,         // a = GameState the choice was made on, v1 = choice
+  TELEM_TOUCH,        // a = TouchType | finger << 4, time = capture, v1 = XY, v2 = queued us
+  TELEM_HIT,          // a = character kind (| TELEM_GRACE), v1 = tap-to-hit us, v2 = XY
+  TELEM_MISS,         // v1 = tap-to-decision us, v2 = XY
+  TELEM_SPAWN,        // a = character kind, v1 = entity id, v2 = XY
+  TELEM_DESPAWN,      // a = character kind, v1 = entity id (left unhit)
+  TELEM_SCORE,        // v1 = score, v2 = special score
+  TELEM_FRAME_BEGIN,  // Compositor flush started
+  TELEM_FRAME_END,    // v1 = bytes pushed
+  TELEM_HANDLER,      // a = handler id, time = start, v1 = us spent
+  TELEM_ROUND_END,    // a = sprite cache hit %, v1 = SPI bytes, v2 = frames
+  TELEM_CACHE,        // v1 = sprites cached, v2 = bytes used
+  TELEM_DROPPED,      // v1 = events lost to a full ring
+  TELEM_TOUCH_FAIL    // v1 = failed panel reads so far, v2 = reports given up so far
+};
+
+struct TelemetryRecord {
+  uint8_t type;
+  uint8_t a;
+  uint32_t time;
+  uint32_t v1;
+  uint32_t v2;
+};
+
+class Telemetry {
+public:
+  void begin() {
+    head = 0;
+    tail = 0;
+    unreported = 0;
+    lost = 0;
+    logged = 0;
+    requested = false;
+  }
+
+  // Queue an event stamped now; false if the ring was full
+  bool log(uint8_t type, uint8_t a, uint32_t v1 = 0, uint32_t v2 = 0) {
+    return logAt(type, a, micros(), v1, v2);
+  }
+
+  // Queue an event that happened at 'time' (micros)
+  bool logAt(uint8_t type, uint8_t a, uint32_t time, uint32_t v1, uint32_t v2) {
+    // A pending loss report needs a slot of its own ahead of this event
+    uint16_t need = unreported ? 2 : 1;
+    if ((uint16_t)(TELEMETRY_EVENTS - queued()) < need) {
+      unreported++;
+      lost++;
+      return false;
+    }
+    if (unreported) {
+      put(TELEM_DROPPED, 0, time, unreported, 0);
+      unreported = 0;
+    }
+    put(type, a, time, v1, v2);
+    return true;
+  }
+
+  // Time spent in handler 'id' since 'startUs'
+  void handler(uint8_t id, uint32_t startUs) {
+    logAt(TELEM_HANDLER, id, startUs, micros() - startUs, 0);
+  }
+
+  // Write queued records while the port has room for a whole one. Returns
+  // the number sent.
+  template <typename Port>
+  uint16_t drain(Port &port) {
+    uint16_t sent = 0;
+    uint8_t buf[TELEMETRY_RECORD_BYTES];
+    while (tail != head && port.availableForWrite() >= TELEMETRY_RECORD_BYTES) {
+      pack(items[tail & (TELEMETRY_EVENTS - 1)], buf);
+      port.write(buf, TELEMETRY_RECORD_BYTES);
+      tail++;
+      sent++;
+    }
+    return sent;
+  }
+
+  // Drain in the background, or on demand once the host has sent a byte
+  template <typename Port>
+  void service(Port &port) {
+#if TELEMETRY_BACKGROUND
+    drain(port);
+#else
+    while (port.available() > 0) {
+      port.read();
+      requested = true;
+    }
+    if (requested) {
+      drain(port);
+      if (tail == head) requested = false;
+    }
+#endif
+  }
+
+  uint16_t queued() const { return (uint16_t)(head - tail); }
+  uint32_t loggedCount() const { return logged; }
+  uint32_t lostCount() const { return lost; }
+
+private:
+  TelemetryRecord items[TELEMETRY_EVENTS];
+  uint16_t head = 0;            // Next slot to fill
+  uint16_t tail = 0;            // Next record to send
+  uint32_t unreported = 0;      // Lost since the last TELEM_DROPPED
+  uint32_t lost = 0;
+  uint32_t logged = 0;
+  bool requested = false;
+
+  void put(uint8_t type, uint8_t a, uint32_t time, uint32_t v1, uint32_t v2) {
+    TelemetryRecord &r = items[head & (TELEMETRY_EVENTS - 1)];
+    r.type = type;
+    r.a = a;
+    r.time = time;
+    r.v1 = v1;
+    r.v2 = v2;
+    head++;
+    logged++;
+  }
+
+  static void put32(uint8_t *p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+  }
+
+  static void pack(const TelemetryRecord &r, uint8_t *buf) {
+    buf[0] = TELEMETRY_SYNC;
+    buf[1] = r.type;
+    buf[2] = r.a;
+    buf[3] = 0;
+    put32(buf + 4, r.time);
+    put32(buf + 8, r.v1);
+    put32(buf + 12, r.v2);
+    uint8_t sum = 0;
+    for (int i = 0; i < TELEMETRY_RECORD_BYTES; i++) sum += buf[i];
+    buf[3] = -sum;
+  }
+};
+
+#endif // TELEMETRY_H
@@ -0,0 +1,144 @@
+/*
+ * timer_wheel.h - Deadline timer wheel for BONK REV8.0
+ *
+ * Every timed effect in the game (spawn and despawn, the countdown, the hit
+ * flash, frenzy expiry, splash screen phases, ...) registers a deadline here
+ * instead of being re-checked with "currentTime - xTime" on every loop()
+ * pass. Timers are addressed by a small fixed ID chosen by the sketch, so
+ * re-scheduling an effect simply moves its one deadline.
+ *
+ * Armed timers hang off a hashed wheel of 1 ms slots. run() only visits the
+ * slots between the previous call and now, and nextDeadline() tells the
+ * idle loop how long it may sleep before anything is due.
+ *
+ * All times are millis(). Deadlines already in the past fire on the next
+ * run(), and comparisons are wrap-safe for deadlines up to ~24 days out.
+ */
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include <Arduino.h>
+
+// Slots in the wheel, must be a power of two. Longer deadlines just stay
+// in their slot for more than one revolution.
+#define TIMER_WHEEL_SLOTS 64
+#define TIMER_WHEEL_NONE  -1
+
+// Sleep the core until the next interrupt. On Teensy 4.x the 1 kHz SysTick
+// wakes it at least once per millisecond, so millis() keeps moving.
+#ifndef WAIT_FOR_INTERRUPT
+#define WAIT_FOR_INTERRUPT() asm volatile("wfi")
+#endif
+
+typedef void (*TimerCallback)();
+
+// Told after each callback returns, with the timer ID and the micros() the
+// callback started at, so the sketch can profile its handlers
+typedef void (*TimerObserver)(uint8_t id, uint32_t startUs);
+
+// N is the number of timer IDs (0 .. N-1)
+template <uint8_t N>
+class TimerWheel {
+public:
+  void begin(unsigned long now) {
+    for (int i = 0; i < TIMER_WHEEL_SLOTS; i++) slots[i] = TIMER_WHEEL_NONE;
+    for (int i = 0; i < N; i++) timers[i].armed = false;
+    cursor = now;
+    fired = 0;
+  }
+
+  // Arm timer 'id' to call 'fn' at time 'at', replacing any pending deadline.
+  // A callback may re-arm its own timer, but only for a time after now.
+  void schedule(uint8_t id, unsigned long at, TimerCallback fn) {
+    cancel(id);
+    Timer &t = timers[id];
+    t.deadline = at;
+    t.fn = fn;
+    t.armed = true;
+    // Overdue timers go in the slot run() looks at first
+    uint8_t slot = ((long)(at - cursor) <= 0 ? cursor : at) & (TIMER_WHEEL_SLOTS - 1);
+    t.slot = slot;
+    t.next = slots[slot];
+    slots[slot] = id;
+  }
+
+  void cancel(uint8_t id) {
+    Timer &t = timers[id];
+    if (!t.armed) return;
+    int8_t *link = &slots[t.slot];
+    while (*link != (int8_t)id) link = &timers[*link].next;
+    *link = t.next;
+    t.armed = false;
+  }
+
+  void cancelAll() {
+    for (uint8_t i = 0; i < N; i++) cancel(i);
+  }
+
+  bool pending(uint8_t id) const { return timers[id].armed; }
+
+  // Fire every timer due at or before 'now'
+  void run(unsigned long now) {
+    unsigned long span = now - cursor;
+    if (span >= TIMER_WHEEL_SLOTS) span = TIMER_WHEEL_SLOTS - 1;
+    unsigned long first = cursor;
+    cursor = now;
+    for (unsigned long i = 0; i <= span; i++) {
+      fireSlot((first + i) & (TIMER_WHEEL_SLOTS - 1), now);
+    }
+  }
+
+  // Earliest armed deadline; false if nothing is scheduled
+  bool nextDeadline(unsigned long &at) const {
+    bool found = false;
+    for (uint8_t i = 0; i < N; i++) {
+      if (!timers[i].armed) continue;
+      if (!found || (long)(timers[i].deadline - at) < 0) at = timers[i].deadline;
+      found = true;
+    }
+    return found;
+  }
+
+  uint32_t firedCount() const { return fired; }
+
+  // NULL turns profiling off
+  void observe(TimerObserver fn) { observer = fn; }
+
+private:
+  struct Timer {
+    unsigned long deadline;
+    TimerCallback fn;
+    int8_t next;       // Next timer in the same slot
+    uint8_t slot;
+    bool armed;
+  };
+
+  Timer timers[N];
+  int8_t slots[TIMER_WHEEL_SLOTS];
+  unsigned long cursor = 0;     // Time of the last run()
+  uint32_t fired = 0;
+  TimerObserver observer = NULL;
+
+  void fireSlot(uint8_t slot, unsigned long now) {
+    // Callbacks can arm and cancel other timers, so unlink one due timer
+    // at a time and start over from the head of the slot
+    bool again = true;
+    while (again) {
+      again = false;
+      for (int8_t id = slots[slot]; id != TIMER_WHEEL_NONE; id = timers[id].next) {
+        if ((long)(timers[id].deadline - now) > 0) continue;
+        TimerCallback fn = timers[id].fn;
+        cancel(id);
+        fired++;
+        uint32_t startUs = observer ? micros() : 0;
+        fn();
+        if (observer) observer(id, startUs);
+        again = true;
+        break;
+      }
+    }
+  }
+};
+
+#endif // TIMER_WHEEL_H
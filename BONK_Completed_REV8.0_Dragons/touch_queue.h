@@ -0,0 +1,273 @@
+/*
+ * touch_queue.h - Interrupt-driven FT6236G touch pipeline for BONK REV8.0
+ *
+ * The FT6236 pulls CTP_INT low whenever it has a new touch report. Instead
+ * of reading the panel over I2C on every loop() pass, the interrupt handler
+ * just stamps the capture time into a small lock-free ring. poll() only
+ * talks to the panel when a stamp is waiting, decodes BOTH touch slots and
+ * turns them into DOWN / MOVE / UP events in a second lock-free ring that
+ * the game drains at its own pace.
+ *
+ * Every event carries the micros() timestamp of the interrupt that produced
+ * it, so tap-to-hit latency can be measured from the moment the finger
+ * landed rather than from when the game got around to looking.
+ */
+
+#ifndef TOUCH_QUEUE_H
+#define TOUCH_QUEUE_H
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <atomic>
+
+// FT6236 registers
+#define FT6236_REG_TD_STATUS  0x02   // Number of touch points, followed by P1 and P2
+#define FT6236_REG_G_MODE     0xA4   // 0 = INT held low while touched, 1 = INT pulse per report
+#define FT6236_REPORT_BYTES   13     // TD_STATUS + 2 x 6 bytes of touch point data
+#define FT6236_MAX_TOUCHES    2
+
+// FT6236 per-point event flags (top two bits of XH)
+#define FT6236_EVENT_DOWN     0
+#define FT6236_EVENT_UP       1
+#define FT6236_EVENT_CONTACT  2
+
+// While a finger is down, re-read the panel this often even without an
+// interrupt so a missed lift-off pulse can't leave a touch stuck
+#define TOUCH_RELEASE_POLL_US 50000UL
+
+// A failed panel read is retried after TOUCH_RETRY_US, doubling each time
+// up to TOUCH_RETRY_MAX_US. After TOUCH_READ_RETRIES failures in a row the
+// owed report is dropped, so a panel that stops answering costs one I2C
+// timeout per backoff period instead of one per loop() pass.
+#define TOUCH_RETRY_US        1000UL
+#define TOUCH_RETRY_MAX_US    64000UL
+#define TOUCH_READ_RETRIES    4
+
+// Single-producer / single-consumer ring. N must be a power of two.
+// push() and pop() may run in different contexts (ISR vs loop) without
+// locking because each side only ever writes its own index. Each index is
+// published with release and read with acquire, so the slot it guards is
+// written before the other side can see it (a dmb on the Cortex-M7).
+template <typename T, uint8_t N>
+class EventRing {
+public:
+  bool push(const T &item) {
+    uint8_t h = head.load(std::memory_order_relaxed);
+    if ((uint8_t)(h - tail.load(std::memory_order_acquire)) >= N) return false;  // Full
+    items[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &item) {
+    uint8_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) return false;  // Empty
+    item = items[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+  }
+  uint8_t count() const {
+    return (uint8_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+  }
+
+private:
+  T items[N];
+  std::atomic<uint8_t> head{0};
+  std::atomic<uint8_t> tail{0};
+};
+
+enum TouchEventType {
+  TOUCH_DOWN,
+  TOUCH_MOVE,
+  TOUCH_UP
+};
+
+struct TouchEvent {
+  uint16_t x, y;         // Screen coordinates (after the sketch's transform)
+  uint8_t id;            // FT6236 touch ID (0 or 1)
+  uint8_t type;          // TouchEventType
+  uint32_t capturedAt;   // micros() when CTP_INT fired
+};
+
+// Converts raw panel coordinates to screen coordinates in place
+typedef void (*TouchTransformFn)(uint16_t *x, uint16_t *y);
+
+// Interrupt stamps waiting to be serviced by poll()
+static EventRing<uint32_t, 8> touchIrqStamps;
+
+static void touchInterrupt() {
+  // If poll() has fallen behind, the newest report supersedes the ones
+  // already queued, so a full ring just drops the stamp
+  touchIrqStamps.push(micros());
+}
+
+class TouchQueue {
+public:
+  void begin(uint8_t intPin, uint8_t i2cAddr, TouchTransformFn transformFn) {
+    addr = i2cAddr;
+    transform = transformFn;
+    activeMask = 0;
+
+    // Pulse INT once per report rather than holding it for the whole touch
+    Wire.beginTransmission(addr);
+    Wire.write(FT6236_REG_G_MODE);
+    Wire.write(1);
+    Wire.endTransmission();
+
+    pinMode(intPin, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(intPin), touchInterrupt, FALLING);
+  }
+
+  // Call once per loop(). Reads the panel only if it has signalled new data
+  // (or a finger is down and the release poll interval has passed).
+  void poll() {
+    uint32_t stamp;
+    // A report that could not be read is still owed, stamped as before
+    bool fired = retry;
+    uint32_t capturedAt = retryAt;
+
+    // One read returns the current state of both slots, so several pending
+    // interrupts collapse into one transfer stamped with the earliest time
+    while (touchIrqStamps.pop(stamp)) {
+      if (!fired) capturedAt = stamp;
+      fired = true;
+    }
+
+    // Backing off after a failed read: keep what is owed for later
+    if (failStreak > 0 && (int32_t)(micros() - nextReadAt) < 0) {
+      retry = fired;
+      retryAt = capturedAt;
+      return;
+    }
+
+    if (!fired) {
+      if (activeMask == 0 || micros() - lastReadAt < TOUCH_RELEASE_POLL_US) return;
+      capturedAt = micros();
+    }
+
+    retryAt = capturedAt;
+    if (readPanel(capturedAt)) {
+      retry = false;
+      failStreak = 0;
+      return;
+    }
+
+    failures++;
+    if (failStreak < 255) failStreak++;
+    retry = failStreak < TOUCH_READ_RETRIES;
+    if (!retry && fired) abandoned++;
+    uint32_t backoff = TOUCH_RETRY_US << (failStreak < 7 ? failStreak - 1 : 6);
+    nextReadAt = micros() + (backoff < TOUCH_RETRY_MAX_US ? backoff : TOUCH_RETRY_MAX_US);
+  }
+
+  // Next event in arrival order; false when the queue is empty
+  bool pop(TouchEvent &ev) { return events.pop(ev); }
+
+  // Number of fingers currently on the panel
+  uint8_t activeTouches() const {
+    return ((activeMask & 1) ? 1 : 0) + ((activeMask & 2) ? 1 : 0);
+  }
+
+  // True once CTP_INT has fired and poll() has not serviced it yet
+  bool pending() const { return !touchIrqStamps.empty(); }
+
+  // True when a panel read came back short and is owed a retry, with its
+  // original capture time
+  bool retryPending() const { return retry; }
+
+  // micros() at which poll() will try the panel again after a failure
+  uint32_t retryAtUs() const { return nextReadAt; }
+
+  uint32_t droppedEvents() const { return dropped; }
+  uint32_t panelReads() const { return reads; }
+  uint32_t readFailures() const { return failures; }     // Short reads
+  uint32_t reportsAbandoned() const { return abandoned; } // Given up after TOUCH_READ_RETRIES
+
+private:
+  uint8_t addr = 0;
+  TouchTransformFn transform = NULL;
+  EventRing<TouchEvent, 16> events;
+
+  uint8_t activeMask = 0;                       // Bit per touch ID that is down
+  uint16_t lastX[FT6236_MAX_TOUCHES];
+  uint16_t lastY[FT6236_MAX_TOUCHES];
+  uint32_t lastReadAt = 0;
+  bool retry = false;
+  uint32_t retryAt = 0;
+  uint8_t failStreak = 0;                       // Failed reads in a row
+  uint32_t nextReadAt = 0;
+  uint32_t dropped = 0;
+  uint32_t reads = 0;
+  uint32_t failures = 0;
+  uint32_t abandoned = 0;
+
+  void emit(uint8_t type, uint8_t id, uint16_t x, uint16_t y, uint32_t capturedAt) {
+    TouchEvent ev;
+    ev.x = x;
+    ev.y = y;
+    ev.id = id;
+    ev.type = type;
+    ev.capturedAt = capturedAt;
+    if (!events.push(ev)) dropped++;
+  }
+
+  // Decode one report into events; false if the panel didn't answer
+  bool readPanel(uint32_t capturedAt) {
+    uint8_t data[FT6236_REPORT_BYTES];
+
+    lastReadAt = micros();
+    reads++;
+
+    Wire.beginTransmission(addr);
+    Wire.write(FT6236_REG_TD_STATUS);
+    Wire.endTransmission(false);
+    if (Wire.requestFrom(addr, (uint8_t)FT6236_REPORT_BYTES) < FT6236_REPORT_BYTES) {
+      while (Wire.available()) Wire.read();
+      return false;
+    }
+    for (int i = 0; i < FT6236_REPORT_BYTES; i++) {
+      data[i] = Wire.read();
+    }
+
+    uint8_t count = data[0] & 0x0F;
+    if (count > FT6236_MAX_TOUCHES) count = 0;  // Panel reports garbage while idle
+    uint8_t seenMask = 0;
+
+    for (uint8_t slot = 0; slot < count; slot++) {
+      const uint8_t *p = &data[1 + slot * 6];
+      uint8_t flag = p[0] >> 6;
+      uint8_t id = p[2] >> 4;
+      if (id >= FT6236_MAX_TOUCHES || flag == FT6236_EVENT_UP) continue;
+
+      uint16_t x = ((p[0] & 0x0F) << 8) | p[1];
+      uint16_t y = ((p[2] & 0x0F) << 8) | p[3];
+      if (transform) transform(&x, &y);
+
+      uint8_t bit = 1 << id;
+      seenMask |= bit;
+      if (!(activeMask & bit)) {
+        emit(TOUCH_DOWN, id, x, y, capturedAt);
+      } else if (x != lastX[id] || y != lastY[id]) {
+        emit(TOUCH_MOVE, id, x, y, capturedAt);
+      }
+      lastX[id] = x;
+      lastY[id] = y;
+    }
+
+    // Anything that was down and is no longer reported has lifted
+    uint8_t lifted = activeMask & ~seenMask;
+    for (uint8_t id = 0; id < FT6236_MAX_TOUCHES; id++) {
+      if (lifted & (1 << id)) {
+        emit(TOUCH_UP, id, lastX[id], lastY[id], capturedAt);
+      }
+    }
+    activeMask = seenMask;
+    return true;
+  }
+};
+
+#endif // TOUCH_QUEUE_H
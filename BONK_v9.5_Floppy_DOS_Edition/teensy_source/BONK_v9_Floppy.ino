@@ -186,21 +186,25 @@ void playSpecialSound() {
 
 // ==================== SPRITE DRAWING ====================
 void drawSprite1Bit(int x, int y, const uint8_t* data, int w, int h, uint16_t color) {
-  int byteIndex = 0;
-  int bitIndex = 7;
+  // Rows are packed MSB first and run on into the next row without padding.
+  // Each horizontal run of set bits goes out as one drawFastHLine instead of
+  // one drawPixel (and one address window) per pixel.
+  int bit = 0;
 
   for (int row = 0; row < h; row++) {
-    for (int col = 0; col < w; col++) {
-      if (data[byteIndex] & (1 << bitIndex)) {
-        tft.drawPixel(x + col, y + row, color);
-      }
-
-      bitIndex--;
-      if (bitIndex < 0) {
-        bitIndex = 7;
-        byteIndex++;
+    int runStart = -1;
+    for (int col = 0; col < w; col++, bit++) {
+      bool set = data[bit >> 3] & (0x80 >> (bit & 7));
+      if (set && runStart < 0) {
+        runStart = col;
+      } else if (!set && runStart >= 0) {
+        tft.drawFastHLine(x + runStart, y + row, col - runStart, color);
+        runStart = -1;
       }
     }
+    if (runStart >= 0) {
+      tft.drawFastHLine(x + runStart, y + row, w - runStart, color);
+    }
   }
 }
 
@@ -0,0 +1,57 @@
+/*
+ * adapter.h - What the bench harness needs to know about a sketch
+ *
+ * Each adapter_*.cpp includes one generated sketch translation unit, so it
+ * can read the sketch's globals directly, and implements these hooks. The
+ * harness itself (bonk_bench.cpp) never sees sketch types.
+ */
+
+#ifndef BENCH_ADAPTER_H
+#define BENCH_ADAPTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Provided by the sketch
+void setup();
+void loop();
+
+const char *sketchName();
+
+// Wire the simulated touch controller to the sketch's pins
+void sketchAttachInput();
+
+// Deliver a touch in screen coordinates to the simulated controller
+void sketchTouch(uint8_t id, bool down, int x, int y);
+
+// GameState as an integer, and a printable name for it
+int sketchState();
+int sketchStateCount();
+const char *sketchStateName(int state);
+
+// The bot plays through scenarios in order; a scenario ends when the game
+// returns to the home state after visiting the result state
+int sketchScenarioCount();
+const char *sketchScenarioName(int scenario);
+int sketchHomeState();
+int sketchResultState();
+
+// Where to tap to make progress through the menus for this scenario.
+// Returns false when the current screen needs no tap (or is gameplay).
+bool sketchMenuTap(int scenario, int *x, int *y);
+
+// Gameplay: centre of a visible target, false if none is up
+bool sketchInGameplay();
+bool sketchTarget(int *x, int *y);
+
+// Final scores, once the result state has been reached
+void sketchDescribeResult(char *buf, size_t len);
+
+// Drawing calls issued by the game so far
+uint64_t sketchPrimitives();
+
+// Sketch specific counters for the end of the report
+void sketchReport(FILE *out);
+
+#endif // BENCH_ADAPTER_H
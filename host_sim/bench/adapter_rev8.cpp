@@ -0,0 +1,143 @@
+/*
+ * adapter_rev8.cpp - Bench hooks for BONK REV8.0 Dragons
+ *
+ * Includes the generated sketch translation unit so the hooks can read the
+ * game state directly.
+ */
+
+#include "rev8_sketch.cpp"
+#include "host_hw.h"
+#include "adapter.h"
+
+static const char *const stateNames[] = {
+  "LOAD_SCREEN", "GAME_SELECT", "PLAYER_SELECT", "MODE_SELECT_P1",
+  "PRESS_START_P1", "GAMEPLAY_P1", "MODE_SELECT_P2", "PRESS_START_P2",
+  "GAMEPLAY_P2", "RESULT_SCREEN"
+};
+
+static const char *const variantNames[] = {
+  "Chicken", "Bunny", "Patriots", "Bluey", "Dragons"
+};
+
+// Centres of the GAME_SELECT buttons, in GameVariant order
+static const int variantButtons[][2] = {
+  {90, 90}, {240, 90}, {390, 90}, {160, 190}, {350, 190}
+};
+
+// Three scenarios per variant: 1P EASY, 1P SHRED GNAR, 2P EASY vs SHRED GNAR
+#define MODES_PER_VARIANT 3
+
+const char *sketchName() {
+#if SPRITE_CACHE_ENABLED
+  return "rev8";
+#else
+  return "rev8 (sprite cache off)";
+#endif
+}
+
+void sketchAttachInput() {
+  hostFt6236Attach(CTP_ADDR, CTP_INT);
+}
+
+// Inverse of transformTouchCoordinates(): screen x = raw y, screen y = 320 - raw x
+void sketchTouch(uint8_t id, bool down, int x, int y) {
+  hostFt6236Touch(id, down, SCREEN_HEIGHT - y, x);
+}
+
+int sketchState() { return currentState; }
+int sketchStateCount() { return sizeof(stateNames) / sizeof(stateNames[0]); }
+
+const char *sketchStateName(int state) {
+  return (state >= 0 && state < sketchStateCount()) ? stateNames[state] : "?";
+}
+
+int sketchScenarioCount() {
+  return (sizeof(variantNames) / sizeof(variantNames[0])) * MODES_PER_VARIANT;
+}
+
+const char *sketchScenarioName(int scenario) {
+  static char name[48];
+  static const char *const modes[] = { "1P EASY", "1P SHRED", "2P EASY/SHRED" };
+  snprintf(name, sizeof(name), "%s %s", variantNames[scenario / MODES_PER_VARIANT],
+           modes[scenario % MODES_PER_VARIANT]);
+  return name;
+}
+
+int sketchHomeState() { return GAME_SELECT; }
+int sketchResultState() { return RESULT_SCREEN; }
+
+bool sketchMenuTap(int scenario, int *x, int *y) {
+  int variant = scenario / MODES_PER_VARIANT;
+  int mode = scenario % MODES_PER_VARIANT;
+  bool shredP1 = (mode == 1);
+
+  // Left and right halves of the two-button screens
+  *y = 170;
+  switch (currentState) {
+    case GAME_SELECT:
+      *x = variantButtons[variant][0];
+      *y = variantButtons[variant][1];
+      return true;
+    case PLAYER_SELECT:
+      *x = (mode == 2) ? 340 : 140;
+      return true;
+    case MODE_SELECT_P1:
+      *x = shredP1 ? 340 : 140;
+      return true;
+    case MODE_SELECT_P2:
+      *x = 340;
+      return true;
+    case PRESS_START_P1:
+    case PRESS_START_P2:
+      *x = 240;
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool sketchInGameplay() {
+  return currentState == GAMEPLAY_P1 || currentState == GAMEPLAY_P2;
+}
+
+// Aims for the regular character first, then the special
+bool sketchTarget(int *x, int *y) {
+  EntityId best = ENTITY_NONE;
+  for (int i = 0; i < characters.liveCount; i++) {
+    EntityId id = characters.live[i];
+    if (best == ENTITY_NONE || characters.kind[id] < characters.kind[best]) best = id;
+  }
+  if (best == ENTITY_NONE) return false;
+  *x = characters.x[best] + characters.size[best] / 2;
+  *y = characters.y[best] + characters.size[best] / 2;
+  return true;
+}
+
+void sketchDescribeResult(char *buf, size_t len) {
+  if (twoPlayerMode) {
+    snprintf(buf, len, "P1 %d+%d  P2 %d+%d", p1Score, p1SpecialScore, p2Score, p2SpecialScore);
+  } else {
+    snprintf(buf, len, "P1 %d+%d", p1Score, p1SpecialScore);
+  }
+}
+
+uint64_t sketchPrimitives() { return tft.primitiveCount(); }
+
+void sketchReport(FILE *out) {
+  fprintf(out, "  compositor          %lu frames, %lu bytes pushed\n",
+          (unsigned long)tft.frameCount(), (unsigned long)tft.totalBytes());
+  fprintf(out, "  palette             %d colors, %lu rebuilds, %lu colors drawn as nearest\n",
+          tft.paletteColors(), (unsigned long)tft.paletteRebuildCount(),
+          (unsigned long)tft.paletteMissCount());
+  fprintf(out, "  sprite cache        %u%% hits (%lu/%lu), %lu evictions, %d sprites, %lu bytes\n",
+          sprites.hitRate(), (unsigned long)sprites.hits(),
+          (unsigned long)(sprites.hits() + sprites.misses()),
+          (unsigned long)sprites.evictions(), sprites.spriteCount(),
+          (unsigned long)sprites.memoryUsed());
+  fprintf(out, "  touch queue         %lu panel reads, %lu failed, %lu reports given up, %lu events dropped\n",
+          (unsigned long)touchInput.panelReads(), (unsigned long)touchInput.readFailures(),
+          (unsigned long)touchInput.reportsAbandoned(), (unsigned long)touchInput.droppedEvents());
+  fprintf(out, "  telemetry           %lu events, %lu dropped, %u still queued\n",
+          (unsigned long)telemetry.loggedCount(), (unsigned long)telemetry.lostCount(),
+          telemetry.queued());
+}
@@ -0,0 +1,119 @@
+/*
+ * adapter_v9.cpp - Bench hooks for BONK v9.5 Floppy Edition (Teensy)
+ *
+ * Includes the generated sketch translation unit so the hooks can read the
+ * game state directly.
+ */
+
+#include "v9_sketch.cpp"
+#include "host_hw.h"
+#include "adapter.h"
+
+static const char *const stateNames[] = {
+  "LOAD_SCREEN", "MENU", "PLAYER_SELECT", "MODE_SELECT", "GAMEPLAY", "RESULT_SCREEN"
+};
+
+static const char *const variantNames[] = { "Chicken", "Bunny", "Dragon" };
+
+// Centres of the MENU variant buttons, in GameVariant order
+static const int variantButtons[] = { 110, 250, 390 };
+
+// Three scenarios per variant: 1P EASY, 1P HARD, 2P EASY vs HARD
+#define MODES_PER_VARIANT 3
+
+const char *sketchName() { return "v9"; }
+
+void sketchAttachInput() {
+  hostXpt2046Attach(TOUCH_IRQ);
+}
+
+// Inverse of the calibration in readTouch(), rounded up so map() lands
+// back on the same pixel
+void sketchTouch(uint8_t, bool down, int x, int y) {
+  uint16_t rawX = 300 + (x * 3400 + SCREEN_WIDTH - 1) / SCREEN_WIDTH;
+  uint16_t rawY = 400 + (y * 3400 + SCREEN_HEIGHT - 1) / SCREEN_HEIGHT;
+  hostXpt2046Touch(down, rawX, rawY);
+}
+
+int sketchState() { return currentState; }
+int sketchStateCount() { return sizeof(stateNames) / sizeof(stateNames[0]); }
+
+const char *sketchStateName(int state) {
+  return (state >= 0 && state < sketchStateCount()) ? stateNames[state] : "?";
+}
+
+int sketchScenarioCount() {
+  return (sizeof(variantNames) / sizeof(variantNames[0])) * MODES_PER_VARIANT;
+}
+
+const char *sketchScenarioName(int scenario) {
+  static char name[48];
+  static const char *const modes[] = { "1P EASY", "1P HARD", "2P EASY/HARD" };
+  snprintf(name, sizeof(name), "%s %s", variantNames[scenario / MODES_PER_VARIANT],
+           modes[scenario % MODES_PER_VARIANT]);
+  return name;
+}
+
+int sketchHomeState() { return MENU; }
+int sketchResultState() { return RESULT_SCREEN; }
+
+bool sketchMenuTap(int scenario, int *x, int *y) {
+  int wanted = scenario / MODES_PER_VARIANT;
+  int mode = scenario % MODES_PER_VARIANT;
+
+  switch (currentState) {
+    case MENU:
+      // Pick the variant first, then press START
+      if (variant != wanted) {
+        *x = variantButtons[wanted];
+        *y = 120;
+      } else {
+        *x = 240;
+        *y = 230;
+      }
+      return true;
+    case PLAYER_SELECT:
+      *x = (mode == 2) ? 335 : 145;
+      *y = 160;
+      return true;
+    case MODE_SELECT:
+      // Player 2 always plays HARD
+      *x = (mode == 1 || currentPlayer == 2) ? 340 : 140;
+      *y = 160;
+      return true;
+    case RESULT_SCREEN:
+      *x = 240;
+      *y = 160;
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool sketchInGameplay() { return currentState == GAMEPLAY; }
+
+bool sketchTarget(int *x, int *y) {
+  if (targetVisible) {
+    *x = targetX + targetSize / 2;
+    *y = targetY + targetSize / 2;
+    return true;
+  }
+  if (specialVisible) {
+    *x = specialX + specialSize / 2;
+    *y = specialY + specialSize / 2;
+    return true;
+  }
+  return false;
+}
+
+void sketchDescribeResult(char *buf, size_t len) {
+  if (twoPlayerMode) {
+    snprintf(buf, len, "P1 %d+%d  P2 %d+%d", p1Score, p1SpecialScore, p2Score, p2SpecialScore);
+  } else {
+    snprintf(buf, len, "P1 %d+%d", p1Score, p1SpecialScore);
+  }
+}
+
+uint64_t sketchPrimitives() { return hostPanelStats.primitives; }
+
+void sketchReport(FILE *) {}
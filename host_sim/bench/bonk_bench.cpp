@@ -0,0 +1,584 @@
+/*
+ * bonk_bench.cpp - Headless benchmark / regression harness for the BONK sketches
+ *
+ * Runs setup() once and then loop() on a virtual clock, feeding touches
+ * either from a recorded trace or from a bot that plays every scenario the
+ * adapter defines (each game variant, 1P and 2P, every difficulty). Each
+ * loop() pass is charged a fixed CPU cost plus the time the panel traffic
+ * it generated would take on the SPI bus, so timing inside the game behaves
+ * like it would on the Teensy.
+ *
+ * Reports loop rate, per-frame primitives / pixels / SPI bytes and worst
+ * loop latency, and can dump the panel as PPM at every state change for
+ * golden-image comparison.
+ */
+
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "host_hw.h"
+#include "adapter.h"
+
+// ==================== OPTIONS ====================
+
+struct Options {
+  unsigned long seed = 1;
+  int firstScenario = 0;
+  int scenarioCount = -1;       // -1 = all
+  const char *tracePath = NULL;
+  const char *recordPath = NULL;
+  uint64_t durationMs = 0;      // 0 = until the scenarios / trace are done
+  uint64_t tailMs = 6000;       // Keep running this long after the last trace event
+  uint32_t loopUs = 100;
+  double spiMHz = 30.0;
+  const char *dumpDir = NULL;
+  const char *goldenDir = NULL;
+  uint64_t dumpEveryMs = 0;
+  bool invert = false;
+  bool serial = false;
+  const char *serialOut = NULL;
+  int accuracy = 85;            // Percent of bot taps aimed at the target
+  uint32_t dwellMs = 500;       // Bot pause on each menu screen
+  uint32_t tapMs = 60;          // Finger down time
+};
+
+static Options opt;
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --seed N           value analogRead(0) returns, seeds random() (default 1)\n"
+    "  --scenario N       bot plays only scenario N\n"
+    "  --scenarios N      bot plays N scenarios (default all)\n"
+    "  --list             list the bot scenarios and exit\n"
+    "  --trace FILE       replay a touch trace instead of running the bot\n"
+    "  --record FILE      write every touch delivered to the panel to FILE\n"
+    "  --duration-ms N    stop after N ms of virtual time\n"
+    "  --tail-ms N        without an end marker, run on N ms after the last touch (default 6000)\n"
+    "  --loop-us N        virtual CPU time charged per loop() pass (default 100)\n"
+    "  --spi-mhz F        display SPI clock used to charge panel traffic (default 30, 0 = free)\n"
+    "  --accuracy P       percent of bot taps that hit (default 85)\n"
+    "  --dump DIR         write the panel as PPM whenever the game leaves a state\n"
+    "  --dump-every-ms N  also dump every N ms of virtual time\n"
+    "  --golden DIR       compare each dump against the same file in DIR\n"
+    "  --invert           invert colors in dumps (REV8 drives an inverted panel)\n"
+    "  --serial           echo the sketch's Serial output to stderr\n"
+    "  --serial-out FILE  write the sketch's raw Serial output to FILE\n",
+    argv0);
+}
+
+// ==================== TOUCH SCHEDULE ====================
+
+struct TouchRecord {
+  uint64_t at;    // Virtual us
+  uint8_t id;
+  bool down;
+  int x, y;       // Screen coordinates
+};
+
+static std::deque<TouchRecord> pending;
+static FILE *recordFile = NULL;
+static uint64_t touchesDelivered = 0;
+
+static uint64_t nextTouchAt() {
+  return pending.empty() ? UINT64_MAX : pending.front().at;
+}
+
+static void fireTouches(uint64_t now) {
+  while (!pending.empty() && pending.front().at <= now) {
+    TouchRecord t = pending.front();
+    pending.pop_front();
+    sketchTouch(t.id, t.down, t.x, t.y);
+    touchesDelivered++;
+    if (recordFile) {
+      fprintf(recordFile, "%.3f %s %u %d %d\n", now / 1000.0, t.down ? "down" : "up",
+              t.id, t.x, t.y);
+    }
+  }
+}
+
+static void schedule(uint64_t at, uint8_t id, bool down, int x, int y) {
+  TouchRecord t = { at, id, down, x, y };
+  std::deque<TouchRecord>::iterator it = pending.end();
+  while (it != pending.begin() && (it - 1)->at > at) --it;
+  pending.insert(it, t);
+}
+
+// Trace format, one touch per line:  <time ms> <down|move|up> <id> <x> <y>
+// in screen coordinates, optionally closed by '<time ms> end' to stop the
+// run there. '#' starts a comment.
+static uint64_t traceEndAt = 0;
+
+static bool loadTrace(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (!f) {
+    perror(path);
+    return false;
+  }
+  char line[256];
+  int lineNo = 0;
+  while (fgets(line, sizeof(line), f)) {
+    lineNo++;
+    char *hash = strchr(line, '#');
+    if (hash) *hash = 0;
+    double ms;
+    char type[8];
+    unsigned id;
+    int x, y;
+    int n = sscanf(line, "%lf %7s %u %d %d", &ms, type, &id, &x, &y);
+    if (n <= 0) continue;
+    if (n == 2 && !strcmp(type, "end")) {
+      traceEndAt = (uint64_t)llround(ms * 1000.0);
+      continue;
+    }
+    if (n != 5 || (strcmp(type, "down") && strcmp(type, "up") && strcmp(type, "move"))) {
+      fprintf(stderr, "%s:%d: expected '<ms> <down|move|up> <id> <x> <y>'\n", path, lineNo);
+      fclose(f);
+      return false;
+    }
+    schedule((uint64_t)llround(ms * 1000.0), (uint8_t)id, strcmp(type, "up") != 0, x, y);
+  }
+  fclose(f);
+  return true;
+}
+
+// ==================== BOT ====================
+
+// Separate generator so the bot never disturbs the sketch's random()
+static uint32_t botState = 0x2545F491;
+
+static uint32_t botRandom(uint32_t range) {
+  botState ^= botState << 13;
+  botState ^= botState >> 17;
+  botState ^= botState << 5;
+  return range ? botState % range : 0;
+}
+
+struct Bot {
+  int scenario = 0;
+  int lastScenario = 0;
+  bool sawResult = false;
+  int state = -1;
+  uint64_t stateEnteredAt = 0;
+  uint64_t busyUntil = 0;
+  int targetX = -1, targetY = -1;
+  uint64_t targetSeenAt = 0;
+  uint32_t reactionUs = 0;
+  bool targetTapped = false;
+  uint64_t taps = 0;
+};
+
+static Bot bot;
+
+// Taps are queued for the moment the bot decides to tap, never earlier
+// than just after 'now', so they interrupt a sleeping sketch exactly where
+// a replayed trace delivers them
+static void botTap(uint64_t now, uint64_t at, int x, int y) {
+  if (at <= now) at = now + 1;
+  schedule(at, 0, true, x, y);
+  schedule(at + opt.tapMs * 1000ULL, 0, false, x, y);
+  bot.busyUntil = at + opt.tapMs * 1000ULL;
+  bot.taps++;
+}
+
+static void botStep(uint64_t now) {
+  int state = sketchState();
+  if (state != bot.state) {
+    bot.state = state;
+    bot.stateEnteredAt = now;
+  }
+  if (now < bot.busyUntil) return;
+
+  if (sketchInGameplay()) {
+    int x, y;
+    if (!sketchTarget(&x, &y)) return;
+    if (x != bot.targetX || y != bot.targetY) {
+      bot.targetX = x;
+      bot.targetY = y;
+      bot.targetSeenAt = now;
+      bot.reactionUs = (150 + botRandom(200)) * 1000;
+      bot.targetTapped = false;
+    }
+    if (bot.targetTapped) return;
+    bot.targetTapped = true;
+    if ((int)botRandom(100) >= opt.accuracy) {
+      // A miss somewhere in the playfield
+      x = 20 + botRandom(440);
+      y = 60 + botRandom(240);
+    }
+    botTap(now, bot.targetSeenAt + bot.reactionUs, x, y);
+    return;
+  }
+
+  int x, y;
+  if (!sketchMenuTap(bot.scenario, &x, &y)) return;
+  uint64_t at = bot.stateEnteredAt + opt.dwellMs * 1000ULL;
+  botTap(now, at, x, y);
+  // If the tap doesn't register, try again after another dwell
+  bot.stateEnteredAt = at > now ? at : now + 1;
+}
+
+// ==================== FRAMEBUFFER DUMPS ====================
+
+static int dumpIndex = 0;
+static int dumpsWritten = 0;
+static int goldenChecked = 0;
+static int goldenFailed = 0;
+
+// mkdir -p
+static bool makeDirs(const char *path) {
+  std::string dir(path);
+  for (size_t i = 1; i <= dir.size(); i++) {
+    if (i == dir.size() || dir[i] == '/') {
+      std::string part = dir.substr(0, i);
+      if (mkdir(part.c_str(), 0755) != 0 && errno != EEXIST) {
+        perror(part.c_str());
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void toRGB(const uint16_t *px, int count, std::vector<uint8_t> &rgb) {
+  rgb.resize(count * 3);
+  for (int i = 0; i < count; i++) {
+    uint16_t c = opt.invert ? ~px[i] : px[i];
+    rgb[i * 3 + 0] = ((c >> 11) & 0x1F) * 255 / 31;
+    rgb[i * 3 + 1] = ((c >> 5) & 0x3F) * 255 / 63;
+    rgb[i * 3 + 2] = (c & 0x1F) * 255 / 31;
+  }
+}
+
+static bool readPPM(const char *path, int *w, int *h, std::vector<uint8_t> &rgb) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  int maxval;
+  bool ok = fscanf(f, "P6 %d %d %d", w, h, &maxval) == 3 && fgetc(f) != EOF;
+  if (ok) {
+    rgb.resize((size_t)*w * *h * 3);
+    ok = fread(rgb.data(), 1, rgb.size(), f) == rgb.size();
+  }
+  fclose(f);
+  return ok;
+}
+
+static void dumpFrame(const char *label, const uint16_t *px, int w, int h) {
+
+  char name[96];
+  snprintf(name, sizeof(name), "%04d_%s.ppm", dumpIndex++, label);
+  std::vector<uint8_t> rgb;
+  toRGB(px, w * h, rgb);
+
+  if (opt.dumpDir) {
+    std::string path = std::string(opt.dumpDir) + "/" + name;
+    FILE *f = fopen(path.c_str(), "wb");
+    if (f) {
+      fprintf(f, "P6\n%d %d\n255\n", w, h);
+      fwrite(rgb.data(), 1, rgb.size(), f);
+      fclose(f);
+      dumpsWritten++;
+    } else {
+      perror(path.c_str());
+    }
+  }
+
+  if (opt.goldenDir) {
+    std::string path = std::string(opt.goldenDir) + "/" + name;
+    std::vector<uint8_t> ref;
+    int rw, rh;
+    goldenChecked++;
+    if (!readPPM(path.c_str(), &rw, &rh, ref)) {
+      fprintf(stderr, "golden: %s missing\n", name);
+      goldenFailed++;
+    } else if (rw != w || rh != h) {
+      fprintf(stderr, "golden: %s is %dx%d, panel is %dx%d\n", name, rw, rh, w, h);
+      goldenFailed++;
+    } else {
+      int diff = 0;
+      for (int i = 0; i < w * h; i++) {
+        if (memcmp(&rgb[i * 3], &ref[i * 3], 3) != 0) diff++;
+      }
+      if (diff) {
+        fprintf(stderr, "golden: %s differs in %d pixels\n", name, diff);
+        goldenFailed++;
+      }
+    }
+  }
+}
+
+// ==================== METRICS ====================
+
+struct StateStats {
+  uint64_t loops = 0;
+  uint64_t frames = 0;
+  uint64_t spiBytes = 0;
+  uint64_t hostNs = 0;
+  uint64_t worstUs = 0;
+};
+
+struct Stat {
+  uint64_t sum = 0;
+  uint64_t max = 0;
+  void add(uint64_t v) {
+    sum += v;
+    if (v > max) max = v;
+  }
+};
+
+static double perSecond(uint64_t count, double seconds) {
+  return seconds > 0 ? count / seconds : 0;
+}
+
+// ==================== MAIN ====================
+
+static bool parseArgs(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+    bool takesValue = true;
+    if (!strcmp(a, "--seed") && v) opt.seed = strtoul(v, NULL, 0);
+    else if (!strcmp(a, "--scenario") && v) { opt.firstScenario = atoi(v); opt.scenarioCount = 1; }
+    else if (!strcmp(a, "--scenarios") && v) opt.scenarioCount = atoi(v);
+    else if (!strcmp(a, "--trace") && v) opt.tracePath = v;
+    else if (!strcmp(a, "--record") && v) opt.recordPath = v;
+    else if (!strcmp(a, "--duration-ms") && v) opt.durationMs = strtoull(v, NULL, 0);
+    else if (!strcmp(a, "--tail-ms") && v) opt.tailMs = strtoull(v, NULL, 0);
+    else if (!strcmp(a, "--loop-us") && v) opt.loopUs = strtoul(v, NULL, 0);
+    else if (!strcmp(a, "--spi-mhz") && v) opt.spiMHz = atof(v);
+    else if (!strcmp(a, "--accuracy") && v) opt.accuracy = atoi(v);
+    else if (!strcmp(a, "--dump") && v) opt.dumpDir = v;
+    else if (!strcmp(a, "--dump-every-ms") && v) opt.dumpEveryMs = strtoull(v, NULL, 0);
+    else if (!strcmp(a, "--golden") && v) opt.goldenDir = v;
+    else if (!strcmp(a, "--serial-out") && v) opt.serialOut = v;
+    else {
+      takesValue = false;
+      if (!strcmp(a, "--invert")) opt.invert = true;
+      else if (!strcmp(a, "--serial")) opt.serial = true;
+      else if (!strcmp(a, "--list")) {
+        for (int s = 0; s < sketchScenarioCount(); s++) {
+          printf("%2d  %s\n", s, sketchScenarioName(s));
+        }
+        exit(0);
+      } else {
+        usage(argv[0]);
+        return false;
+      }
+    }
+    if (takesValue) i++;
+  }
+
+  int total = sketchScenarioCount();
+  if (opt.firstScenario < 0 || opt.firstScenario >= total) {
+    fprintf(stderr, "scenario must be 0..%d\n", total - 1);
+    return false;
+  }
+  if (opt.scenarioCount < 0 || opt.firstScenario + opt.scenarioCount > total) {
+    opt.scenarioCount = total - opt.firstScenario;
+  }
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (!parseArgs(argc, argv)) return 2;
+
+  if (opt.dumpDir && !makeDirs(opt.dumpDir)) return 2;
+  if (opt.recordPath) {
+    recordFile = fopen(opt.recordPath, "w");
+    if (!recordFile) {
+      perror(opt.recordPath);
+      return 2;
+    }
+    fprintf(recordFile, "# BONK touch trace: <time ms> <down|up> <id> <x> <y>\n");
+    fprintf(recordFile, "# sketch %s, seed %lu\n", sketchName(), opt.seed);
+  }
+  if (opt.tracePath && !loadTrace(opt.tracePath)) return 2;
+  uint64_t traceEnd = traceEndAt;
+  if (!traceEnd) traceEnd = (pending.empty() ? 0 : pending.back().at) + opt.tailMs * 1000;
+
+  bool useBot = !opt.tracePath;
+  botState ^= (uint32_t)opt.seed * 2654435761u;
+  bot.scenario = opt.firstScenario;
+  bot.lastScenario = opt.firstScenario + opt.scenarioCount;
+
+  hostSerialEcho(opt.serial);
+  if (opt.serialOut && !hostSerialCapture(opt.serialOut)) {
+    perror(opt.serialOut);
+    return 2;
+  }
+  hostSetAnalog((int)opt.seed);
+  hostSetScheduler(nextTouchAt, fireTouches);
+  sketchAttachInput();
+  setup();
+
+  int stateCount = sketchStateCount();
+  std::vector<StateStats> perState(stateCount);
+  uint64_t loops = 0, frames = 0, hostNsTotal = 0;
+  uint64_t worstUs = 0, worstHostNs = 0;
+  int worstState = 0, worstHostState = 0;
+  Stat framePrims, framePixels, frameBytes;
+  uint64_t primsAtFrameStart = sketchPrimitives();
+  uint64_t nextDumpAt = opt.dumpEveryMs ? opt.dumpEveryMs * 1000 : UINT64_MAX;
+  uint64_t startUs = hostClock();
+  uint64_t scenarioStartUs = startUs;
+  char result[96] = "";
+  bool dumping = opt.dumpDir || opt.goldenDir;
+  std::vector<uint16_t> shown;   // Panel contents after the last pass that changed it
+  int panelW = 0, panelH = 0;
+  if (dumping) {
+    const uint16_t *px = hostPanelPixels(&panelW, &panelH);
+    if (px) shown.assign(px, px + panelW * panelH);
+  }
+
+  printf("BONK host bench - %s, seed %lu\n", sketchName(), opt.seed);
+  if (useBot) {
+    printf("  bot playing scenarios %d-%d of %d\n", opt.firstScenario,
+           bot.lastScenario - 1, sketchScenarioCount());
+  } else {
+    printf("  replaying %s\n", opt.tracePath);
+  }
+
+  int state = sketchState();
+  while (true) {
+    uint64_t before = hostClock();
+    uint64_t sleptBefore = hostSleepTime();
+    HostPanelStats panelBefore = hostPanelStats;
+
+    std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+    loop();
+    uint64_t hostNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - t0).count();
+
+    // Charge the pass: fixed CPU cost plus the SPI time for its panel traffic
+    uint64_t spi = hostPanelStats.spiBytes - panelBefore.spiBytes;
+    uint64_t busUs = opt.spiMHz > 0 ? (uint64_t)(spi * 8 / opt.spiMHz) : 0;
+    hostAdvance(opt.loopUs + busUs);
+    // Time asleep waiting for an interrupt is idle, not latency
+    uint64_t elapsedUs = hostClock() - before - (hostSleepTime() - sleptBefore);
+
+    loops++;
+    hostNsTotal += hostNs;
+    StateStats &ss = perState[state < stateCount ? state : 0];
+    ss.loops++;
+    ss.hostNs += hostNs;
+    ss.spiBytes += spi;
+    if (elapsedUs > ss.worstUs) ss.worstUs = elapsedUs;
+    if (elapsedUs > worstUs) {
+      worstUs = elapsedUs;
+      worstState = state;
+    }
+    if (hostNs > worstHostNs) {
+      worstHostNs = hostNs;
+      worstHostState = state;
+    }
+
+    // A frame is any pass that put something on the panel
+    if (spi > 0) {
+      uint64_t prims = sketchPrimitives();
+      frames++;
+      ss.frames++;
+      framePrims.add(prims - primsAtFrameStart);
+      framePixels.add(hostPanelStats.pixels - panelBefore.pixels);
+      frameBytes.add(spi);
+      primsAtFrameStart = prims;
+    }
+
+    // Dump what was on the glass before the pass that changed state; some
+    // screens draw their successor in the same pass
+    int newState = sketchState();
+    if (newState != state) {
+      if (dumping && !shown.empty()) dumpFrame(sketchStateName(state), shown.data(), panelW, panelH);
+      if (newState == sketchResultState()) {
+        sketchDescribeResult(result, sizeof(result));
+      }
+      state = newState;
+    }
+    if (dumping && spi > 0) {
+      const uint16_t *px = hostPanelPixels(&panelW, &panelH);
+      if (px) shown.assign(px, px + panelW * panelH);
+    }
+    if (hostClock() >= nextDumpAt) {
+      if (dumping && !shown.empty()) dumpFrame("periodic", shown.data(), panelW, panelH);
+      nextDumpAt += opt.dumpEveryMs * 1000;
+    }
+
+    uint64_t now = hostClock();
+    if (useBot) {
+      if (state == sketchResultState()) bot.sawResult = true;
+      if (bot.sawResult && state == sketchHomeState()) {
+        printf("  %-22s %7.1f s  %s\n", sketchScenarioName(bot.scenario),
+               (now - scenarioStartUs) / 1e6, result);
+        bot.sawResult = false;
+        scenarioStartUs = now;
+        if (++bot.scenario >= bot.lastScenario) break;
+      }
+      botStep(now);
+    } else if (pending.empty() && now >= traceEnd) {
+      break;
+    }
+    if (opt.durationMs && now - startUs >= opt.durationMs * 1000) break;
+  }
+
+  if (dumping && !shown.empty()) dumpFrame("final", shown.data(), panelW, panelH);
+  if (recordFile) {
+    fprintf(recordFile, "%.3f end\n", hostClock() / 1000.0);
+    fclose(recordFile);
+  }
+
+  double virtualS = (hostClock() - startUs) / 1e6;
+  double hostS = hostNsTotal / 1e9;
+  uint64_t f = frames ? frames : 1;
+
+  printf("\n");
+  printf("  virtual time        %.1f s\n", virtualS);
+  printf("  loop iterations     %llu  (%.0f/s virtual, %.0f/s host)\n",
+         (unsigned long long)loops, perSecond(loops, virtualS), perSecond(loops, hostS));
+  printf("  asleep              %.1f s  (%.1f%% of virtual time)\n",
+         hostSleepTime() / 1e6, virtualS > 0 ? hostSleepTime() / 1e4 / virtualS : 0.0);
+  printf("  worst loop latency  %.2f ms virtual in %s, %.3f ms host in %s\n",
+         worstUs / 1000.0, sketchStateName(worstState),
+         worstHostNs / 1e6, sketchStateName(worstHostState));
+  printf("  frames              %llu  (%.1f/s virtual)\n",
+         (unsigned long long)frames, perSecond(frames, virtualS));
+  printf("  per frame           primitives avg %.1f max %llu\n",
+         (double)framePrims.sum / f, (unsigned long long)framePrims.max);
+  printf("                      pixels     avg %.0f max %llu\n",
+         (double)framePixels.sum / f, (unsigned long long)framePixels.max);
+  printf("                      SPI bytes  avg %.0f max %llu\n",
+         (double)frameBytes.sum / f, (unsigned long long)frameBytes.max);
+  printf("  totals              %llu primitives, %llu pixels, %llu SPI bytes, %llu windows\n",
+         (unsigned long long)sketchPrimitives(), (unsigned long long)hostPanelStats.pixels,
+         (unsigned long long)hostPanelStats.spiBytes, (unsigned long long)hostPanelStats.windows);
+  printf("  serial              %llu bytes\n", (unsigned long long)hostSerialBytes());
+  printf("  touches             %llu delivered", (unsigned long long)touchesDelivered);
+  if (useBot) printf(", %llu bot taps", (unsigned long long)bot.taps);
+  printf("\n");
+  sketchReport(stdout);
+
+  printf("\n  %-16s %10s %8s %14s %12s %10s\n",
+         "state", "loops", "frames", "SPI bytes", "host ns/loop", "worst ms");
+  for (int s = 0; s < stateCount; s++) {
+    const StateStats &ss = perState[s];
+    if (!ss.loops) continue;
+    printf("  %-16s %10llu %8llu %14llu %12.0f %10.2f\n", sketchStateName(s),
+           (unsigned long long)ss.loops, (unsigned long long)ss.frames,
+           (unsigned long long)ss.spiBytes, (double)ss.hostNs / ss.loops, ss.worstUs / 1000.0);
+  }
+
+  if (opt.dumpDir) printf("\n  %d frames dumped to %s\n", dumpsWritten, opt.dumpDir);
+  if (opt.goldenDir) {
+    printf("\n  golden: %d of %d frames match %s\n", goldenChecked - goldenFailed,
+           goldenChecked, opt.goldenDir);
+    if (goldenFailed) return 1;
+  }
+  return 0;
+}
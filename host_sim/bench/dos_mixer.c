@@ -0,0 +1,239 @@
+/*
+ * dos_mixer.c - Host benchmark for the DOS port's Sound Blaster mixer
+ *
+ * Builds BONK_v9.5_Floppy_DOS_Edition/dos_port/MIXER.C and the generated
+ * sample bank unchanged, plays a scripted round of effects through it in
+ * DMA-sized blocks exactly as the IRQ handler would, and writes the result
+ * as an 8-bit mono WAV.
+ *
+ * Before the benchmark it checks the mixer against known answers (silence,
+ * a lone voice at full volume, clipping, resampling) and exits non-zero if
+ * any of them is off, so 'make check' covers it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "SOUND.H"
+#include "MIXER.H"
+#include "SAMPLES.H"
+
+// ==================== OPTIONS ====================
+
+typedef struct {
+  const char *wavPath;
+  unsigned int rate;      // Output rate (the DOS build runs at 11111 Hz)
+  unsigned int block;     // Samples per IRQ
+  unsigned int seconds;   // Length of the scripted round
+} Options;
+
+static Options opt = { "build/dos_mixer.wav", 11111, 256, 45 };
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --wav FILE     where to write the mix (default build/dos_mixer.wav)\n"
+    "  --rate N       output rate in Hz (default 11111, what the DSP runs at)\n"
+    "  --block N      samples mixed per IRQ (default 256)\n"
+    "  --seconds N    length of the scripted round (default 45)\n",
+    argv0);
+  exit(2);
+}
+
+static void parseArgs(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!strcmp(a, "--wav") && v) { opt.wavPath = v; i++; }
+    else if (!strcmp(a, "--rate") && v) { opt.rate = (unsigned)atoi(v); i++; }
+    else if (!strcmp(a, "--block") && v) { opt.block = (unsigned)atoi(v); i++; }
+    else if (!strcmp(a, "--seconds") && v) { opt.seconds = (unsigned)atoi(v); i++; }
+    else usage(argv[0]);
+  }
+  if (opt.rate == 0 || opt.block == 0) usage(argv[0]);
+}
+
+// ==================== KNOWN ANSWERS ====================
+
+static int failures = 0;
+
+static void expect(int ok, const char *what) {
+  if (!ok) {
+    fprintf(stderr, "mixer: %s\n", what);
+    failures++;
+  }
+}
+
+static void play(int voice, SoundEffect fx, int volume) {
+  mixPlay(voice, sampleBank[fx].data, sampleBank[fx].length, SAMPLE_RATE, volume);
+}
+
+static void checkMixer(void) {
+  unsigned char out[16384];
+  unsigned int len = sampleBank[SND_FRENZY_START].length;
+  const signed char *src = sampleBank[SND_FRENZY_START].data;
+  int ok;
+
+  // Nothing playing is DC 128
+  mixInit(SAMPLE_RATE);
+  mixRender(out, 1000);
+  ok = 1;
+  for (int i = 0; i < 1000; i++) ok &= out[i] == 128;
+  expect(ok, "silence is not 128");
+
+  // One voice at full volume and the native rate comes out bit-exact,
+  // then stops by itself
+  mixInit(SAMPLE_RATE);
+  play(VOICE_FRENZY, SND_FRENZY_START, MIX_FULL_VOLUME);
+  mixRender(out, len + 100);
+  ok = 1;
+  for (unsigned i = 0; i < len; i++) ok &= out[i] == (unsigned char)(src[i] + 128);
+  for (unsigned i = len; i < len + 100; i++) ok &= out[i] == 128;
+  expect(ok, "single voice at full volume is not bit-exact");
+  expect(!mixActive(VOICE_FRENZY), "voice still active after its sample ended");
+
+  // Half volume halves (rounding toward minus infinity)
+  mixInit(SAMPLE_RATE);
+  play(VOICE_FRENZY, SND_FRENZY_START, MIX_FULL_VOLUME / 2);
+  mixRender(out, len);
+  ok = 1;
+  for (unsigned i = 0; i < len; i++) ok &= out[i] == (unsigned char)((src[i] >> 1) + 128);
+  expect(ok, "half volume is not sample / 2");
+
+  // Four copies at full volume clip instead of wrapping
+  mixInit(SAMPLE_RATE);
+  for (int v = 0; v < MIX_VOICES; v++) play(v, SND_FRENZY_START, MIX_FULL_VOLUME);
+  mixRender(out, len);
+  ok = 1;
+  for (unsigned i = 0; i < len; i++) {
+    int sum = src[i] * MIX_VOICES;
+    if (sum > 127) sum = 127;
+    if (sum < -128) sum = -128;
+    ok &= out[i] == (unsigned char)(sum + 128);
+  }
+  expect(ok, "four voices do not clip correctly");
+
+  // Resampled playback lasts length * outRate / inRate output samples
+  mixInit(opt.rate);
+  play(VOICE_FRENZY, SND_FRENZY_START, MIX_FULL_VOLUME);
+  unsigned int played = 0;
+  while (mixActive(VOICE_FRENZY) && played < sizeof(out)) {
+    mixRender(out, 1);
+    played++;
+  }
+  unsigned int want = (unsigned int)((uint64_t)len * opt.rate / SAMPLE_RATE);
+  expect(played + 2 >= want && played <= want + 2, "resampled length is off");
+}
+
+// ==================== SCRIPTED ROUND ====================
+
+// Roughly what a HARD round sounds like: a bonk every 300 ms, a special
+// every 2.5 s, frenzy after the fifth bonk and again 3 s before the end
+// (where all four voices overlap), a tick each of the last five seconds,
+// then the game over sting
+static void triggerEffects(unsigned long fromMs, unsigned long toMs, unsigned long endMs) {
+  static const SoundEffect bonks[] = { SND_BONK_CHICKEN, SND_BONK_BUNNY, SND_BONK_DRAGON };
+  for (unsigned long t = fromMs; t < toMs; t++) {
+    if (t < endMs && t % 300 == 0) play(VOICE_BONK, bonks[(t / 300) % 3], 256);
+    if (t < endMs && t % 2500 == (endMs - 3000) % 2500) play(VOICE_SPECIAL, SND_SPECIAL_COLLECT, 224);
+    if (t == 1500 || t + 3000 == endMs) play(VOICE_FRENZY, SND_FRENZY_START, 208);
+    if (t + 5000 >= endMs && t < endMs && (endMs - t) % 1000 == 0) play(VOICE_TICK, SND_TIMER_TICK, 128);
+    if (t == endMs) play(VOICE_FRENZY, SND_GAME_OVER, 256);
+  }
+}
+
+static void writeLE(FILE *f, uint32_t v, int bytes) {
+  for (int i = 0; i < bytes; i++) fputc((v >> (8 * i)) & 0xFF, f);
+}
+
+static int writeWav(const char *path, const unsigned char *pcm, uint32_t n, uint32_t rate) {
+  FILE *f = fopen(path, "wb");
+  if (!f) return 0;
+  fwrite("RIFF", 1, 4, f); writeLE(f, 36 + n, 4);
+  fwrite("WAVEfmt ", 1, 8, f); writeLE(f, 16, 4);
+  writeLE(f, 1, 2);          // PCM
+  writeLE(f, 1, 2);          // Mono
+  writeLE(f, rate, 4);
+  writeLE(f, rate, 4);       // Bytes per second
+  writeLE(f, 1, 2);          // Block align
+  writeLE(f, 8, 2);          // Bits per sample
+  fwrite("data", 1, 4, f); writeLE(f, n, 4);
+  fwrite(pcm, 1, n, f);
+  fclose(f);
+  return 1;
+}
+
+static double nowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+  parseArgs(argc, argv);
+
+  checkMixer();
+
+  // One extra second for the game over sting to ring out
+  unsigned long endMs = opt.seconds * 1000UL;
+  uint32_t total = (uint32_t)((uint64_t)(endMs + 1000) * opt.rate / 1000);
+  uint32_t blocks = (total + opt.block - 1) / opt.block;
+  unsigned char *pcm = (unsigned char *)calloc((size_t)blocks * opt.block, 1);
+  if (!pcm) return 1;
+
+  mixInit(opt.rate);
+
+  double busyNs = 0, worstNs = 0;
+  unsigned long lastMs = 0;
+  unsigned int peakVoices = 0;
+  uint64_t clipped = 0;
+
+  for (uint32_t b = 0; b < blocks; b++) {
+    // Effects start on block boundaries, as they would on DOS where the
+    // game only gets between two IRQs
+    unsigned long blockMs = (unsigned long)((uint64_t)b * opt.block * 1000 / opt.rate);
+    triggerEffects(lastMs, blockMs + 1, endMs);
+    lastMs = blockMs + 1;
+
+    unsigned int active = 0;
+    for (int v = 0; v < MIX_VOICES; v++) active += mixActive(v);
+    if (active > peakVoices) peakVoices = active;
+
+    unsigned char *out = pcm + (size_t)b * opt.block;
+    double t0 = nowNs();
+    mixRender(out, opt.block);
+    double ns = nowNs() - t0;
+    busyNs += ns;
+    if (ns > worstNs) worstNs = ns;
+
+    for (unsigned i = 0; i < opt.block; i++) clipped += out[i] == 0 || out[i] == 255;
+  }
+
+  uint32_t samples = blocks * opt.block;
+  double audioNs = (double)samples * 1e9 / opt.rate;
+
+  printf("BONK DOS mixer bench - %u Hz, %u-sample blocks, %u voices\n",
+         opt.rate, opt.block, MIX_VOICES);
+  printf("\n");
+  printf("  known answers       %s\n", failures ? "FAILED" : "ok");
+  printf("  audio               %.1f s, %u blocks\n", audioNs / 1e9, blocks);
+  printf("  peak voices         %u\n", peakVoices);
+  printf("  clipped samples     %llu\n", (unsigned long long)clipped);
+  printf("  mix time per block  avg %.2f us, max %.2f us\n",
+         busyNs / blocks / 1000.0, worstNs / 1000.0);
+  printf("  mix time per sample %.2f ns  (%.4f%% of real time on this host)\n",
+         busyNs / samples, busyNs * 100.0 / audioNs);
+
+  if (!writeWav(opt.wavPath, pcm, samples, opt.rate)) {
+    fprintf(stderr, "cannot write %s\n", opt.wavPath);
+    failures++;
+  } else {
+    printf("  wrote               %s\n", opt.wavPath);
+  }
+
+  free(pcm);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,330 @@
+/*
+ * entity_pool.c - Host benchmark for the shared entity pool (entities.h)
+ *
+ * Builds BONK_Completed_REV8.0_Dragons/entities.h as plain C, the way the
+ * DOS port sees it, and drives it through random rounds of spawns,
+ * despawns, moves and taps. Every tap is checked against a brute-force
+ * scan of the whole pool with the same rules, and every placement that
+ * claims to be clear is checked against every live entity, so 'make check'
+ * catches a grid bug.
+ *
+ * It then times taps and placements with 8 to 48 live targets on the REV8
+ * playfield, next to the linear isTapInCharacter() scan the grid replaced.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "entities.h"
+
+// ==================== OPTIONS ====================
+
+typedef struct {
+  unsigned int seed;
+  unsigned int rounds;    // Random operations in the known-answer pass
+  unsigned int taps;      // Taps timed per population
+} Options;
+
+static Options opt = { 7, 200000, 200000 };
+
+static void usage(const char *argv0) {
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  --seed N       random seed (default 7)\n"
+    "  --rounds N     operations checked against a brute-force scan (default 200000)\n"
+    "  --taps N       taps timed per population (default 200000)\n",
+    argv0);
+  exit(2);
+}
+
+static void parseArgs(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!strcmp(a, "--seed") && v) { opt.seed = (unsigned)atoi(v); i++; }
+    else if (!strcmp(a, "--rounds") && v) { opt.rounds = (unsigned)atoi(v); i++; }
+    else if (!strcmp(a, "--taps") && v) { opt.taps = (unsigned)atoi(v); i++; }
+    else usage(argv[0]);
+  }
+}
+
+// ==================== HELPERS ====================
+
+// REV8 playfield and character sizes
+#define FIELD_W    480
+#define FIELD_H    320
+#define TAP_MARGIN 40
+#define MAX_SIZE   60
+#define GAP        20
+
+static uint32_t rngState;
+
+static uint32_t xorshift(void) {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+static int rnd(int lo, int hi) {
+  return hi <= lo ? lo : lo + (int)(xorshift() % (uint32_t)(hi - lo));
+}
+
+static double nowNs(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int failures = 0;
+
+static void expect(int ok, const char *what) {
+  if (!ok && failures++ < 10) fprintf(stderr, "entities: %s\n", what);
+}
+
+// entityHit() without the grid: every entity, same ranking
+static EntityId bruteHit(const EntityPool *p, int tx, int ty, unsigned long now) {
+  EntityId best = ENTITY_NONE;
+  int bestRank = 0;
+  long bestDist = 0;
+  for (int id = 0; id < ENTITY_MAX; id++) {
+    int x = p->x[id], y = p->y[id], s = p->size[id], pad = p->pad[id];
+    if (p->state[id] == ENTITY_FREE) continue;
+    if (p->state[id] == ENTITY_GHOST && (long)(now - p->graceUntil[id]) >= 0) continue;
+    if (tx < x - pad || tx > x + s + pad || ty < y - pad || ty > y + s + pad) continue;
+    int rank = p->kind[id] + (p->state[id] == ENTITY_GHOST ? ENTITY_KINDS : 0);
+    long dx = 2L * tx - (2L * x + s), dy = 2L * ty - (2L * y + s);
+    long dist = dx * dx + dy * dy;
+    if (best == ENTITY_NONE || rank < bestRank || (rank == bestRank && dist < bestDist)) {
+      best = (EntityId)id;  // Ascending ids, so ties go to the lowest
+      bestRank = rank;
+      bestDist = dist;
+    }
+  }
+  return best;
+}
+
+static int bruteOverlaps(const EntityPool *p, int x, int y, int size, int gap) {
+  for (int i = 0; i < p->liveCount; i++) {
+    EntityId id = p->live[i];
+    if (p->x[id] <= x + size + gap && p->x[id] + p->size[id] >= x - gap &&
+        p->y[id] <= y + size + gap && p->y[id] + p->size[id] >= y - gap) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Is there any clear top-left in the range, on a 4 px lattice?
+static int bruteRoom(const EntityPool *p, int size, int gap, int x1, int y1, int x2, int y2) {
+  for (int y = y1; y < y2; y += 4) {
+    for (int x = x1; x < x2; x += 4) {
+      if (!bruteOverlaps(p, x, y, size, gap)) return 1;
+    }
+  }
+  return 0;
+}
+
+static int isSet(const unsigned long *bits, int id) {
+  return (bits[ENTITY_WORD(id)] & ENTITY_BIT(id)) != 0;
+}
+
+// Book-keeping invariants: dense list, free stack, grid and counters agree
+static int consistent(const EntityPool *p) {
+  int live = 0, ghosts = 0;
+  int kinds[ENTITY_KINDS] = { 0 };
+
+  for (int id = 0; id < ENTITY_MAX; id++) {
+    if (p->state[id] == ENTITY_LIVE) { live++; kinds[p->kind[id]]++; }
+    if (p->state[id] == ENTITY_GHOST) ghosts++;
+    if (isSet(p->liveBits, id) != (p->state[id] == ENTITY_LIVE)) return 0;
+  }
+  if (live != p->liveCount || live + ghosts + p->freeCount != ENTITY_MAX) return 0;
+  for (int i = 0; i < p->liveCount; i++) {
+    EntityId id = p->live[i];
+    if (p->state[id] != ENTITY_LIVE || p->liveSlot[id] != i) return 0;
+  }
+  for (int k = 0; k < ENTITY_KINDS; k++) if (kinds[k] != p->kindCount[k]) return 0;
+  // A cell holds exactly the entities whose hit box reaches into it
+  for (int c = 0; c < p->cols * p->rows; c++) {
+    int cx = (c % p->cols) * p->cellSize, cy = (c / p->cols) * p->cellSize;
+    int lastCol = c % p->cols == p->cols - 1, lastRow = c / p->cols == p->rows - 1;
+    for (int id = 0; id < ENTITY_MAX; id++) {
+      int pad = p->pad[id];
+      int covers = p->state[id] != ENTITY_FREE &&
+                   (p->x[id] + p->size[id] + pad >= cx || c % p->cols == 0) &&
+                   (p->x[id] - pad < cx + p->cellSize || lastCol) &&
+                   (p->y[id] + p->size[id] + pad >= cy || c / p->cols == 0) &&
+                   (p->y[id] - pad < cy + p->cellSize || lastRow);
+      if (isSet(p->cellBits[c], id) != covers) return 0;
+    }
+  }
+  return 1;
+}
+
+// ==================== KNOWN ANSWERS ====================
+
+static EntityPool pool;
+
+static void spawnRandom(EntityPool *p, unsigned long now) {
+  int size = rnd(20, MAX_SIZE);
+  int x, y;
+  int clear = entityPlace(p, size, GAP, size + 20, 40 + size,
+                          FIELD_W - size - 20, FIELD_H - size - 20, rnd, &x, &y);
+  expect(!clear || !bruteOverlaps(p, x, y, size, GAP), "placement claimed clear but overlaps");
+  entitySpawn(p, rnd(0, 2), x, y, size, TAP_MARGIN, now + rnd(300, 1500));
+}
+
+static void checkPool(void) {
+  unsigned long now = 1000;
+
+  entityInit(&pool, FIELD_W, FIELD_H, MAX_SIZE + 2 * TAP_MARGIN);
+  expect(pool.cols * pool.rows <= ENTITY_GRID_CELLS, "grid has more cells than it has room for");
+
+  // A tap exactly on the edge of the margin hits, one pixel further misses
+  EntityId a = entitySpawn(&pool, 0, 100, 100, 40, TAP_MARGIN, 0);
+  expect(entityHit(&pool, 100 - TAP_MARGIN, 140 + TAP_MARGIN, now) == a, "margin edge missed");
+  expect(entityHit(&pool, 99 - TAP_MARGIN, 120, now) == ENTITY_NONE, "outside the margin hit");
+
+  // Regular before special, live before ghost
+  EntityId b = entitySpawn(&pool, 1, 110, 110, 30, TAP_MARGIN, 0);
+  expect(entityHit(&pool, 125, 125, now) == a, "special beat a regular");
+  entityDespawn(&pool, a, now, 800);
+  expect(entityHit(&pool, 125, 125, now) == b, "ghost beat a live entity");
+  entityRelease(&pool, b);
+  expect(entityHit(&pool, 125, 125, now + 799) == a, "ghost expired early");
+  expect(entityHit(&pool, 125, 125, now + 800) == ENTITY_NONE, "ghost outlived its grace");
+
+  // Fill up with live entities, then one more is refused
+  entityReset(&pool);
+  for (int i = 0; i < ENTITY_MAX; i++) entitySpawn(&pool, 0, rnd(0, FIELD_W), rnd(0, FIELD_H), 20, 0, 0);
+  expect(entitySpawn(&pool, 0, 0, 0, 20, 0, 0) == ENTITY_NONE, "spawned into a full pool");
+
+  // Random churn, every tap checked against the brute-force scan
+  entityReset(&pool);
+  for (unsigned r = 0; r < opt.rounds; r++) {
+    now += rnd(0, 40);
+    int op = rnd(0, 10);
+    if (op < 3 && pool.liveCount < 40) {
+      spawnRandom(&pool, now);
+    } else if (op < 5 && pool.liveCount > 0) {
+      EntityId id = pool.live[rnd(0, pool.liveCount)];
+      entityDespawn(&pool, id, now, rnd(0, 2) ? 800 : 0);
+    } else if (op < 6 && pool.liveCount > 0) {
+      EntityId id = pool.live[rnd(0, pool.liveCount)];
+      entityMove(&pool, id, pool.x[id] + rnd(-10, 11), pool.y[id] + rnd(-10, 11));
+    } else {
+      int tx = rnd(-10, FIELD_W + 10), ty = rnd(-10, FIELD_H + 10);
+      EntityId want = bruteHit(&pool, tx, ty, now);
+      EntityId got = entityHit(&pool, tx, ty, now);
+      expect(got == want, "grid hit test disagrees with a full scan");
+      if (got != ENTITY_NONE && rnd(0, 2)) entityRelease(&pool, got);
+    }
+    if (r % 64 == 0) expect(consistent(&pool), "pool book-keeping is inconsistent");
+  }
+  expect(consistent(&pool), "pool book-keeping is inconsistent");
+}
+
+// ==================== TIMING ====================
+
+// What handleTap() would do without the grid: isTapInCharacter() on
+// every live target, keeping the best one by the same rules
+static int linearHit(const EntityPool *p, int tx, int ty) {
+  EntityId best = ENTITY_NONE;
+  long bestDist = 0;
+  for (int i = 0; i < p->liveCount; i++) {
+    EntityId id = p->live[i];
+    int x = p->x[id], y = p->y[id], s = p->size[id];
+    if (tx >= x - TAP_MARGIN && tx <= x + s + TAP_MARGIN &&
+        ty >= y - TAP_MARGIN && ty <= y + s + TAP_MARGIN) {
+      long dx = 2L * tx - (2L * x + s), dy = 2L * ty - (2L * y + s);
+      long dist = dx * dx + dy * dy;
+      if (best == ENTITY_NONE || p->kind[id] < p->kind[best] ||
+          (p->kind[id] == p->kind[best] && dist < bestDist)) {
+        best = id;
+        bestDist = dist;
+      }
+    }
+  }
+  return best;
+}
+
+// Placements that found a clear spot, out of those where one existed
+static int clearFound, clearPossible;
+
+static void timePopulation(int targets) {
+  static int tapX[4096], tapY[4096];
+  unsigned long now = 1000;
+  int clear = 0, placed = 0;
+  volatile int sink = 0;
+
+  entityInit(&pool, FIELD_W, FIELD_H, MAX_SIZE + 2 * TAP_MARGIN);
+  while (pool.liveCount < targets) {
+    int size = rnd(20, MAX_SIZE), x, y;
+    int x1 = size + 20, y1 = 40 + size, x2 = FIELD_W - size - 20, y2 = FIELD_H - size - 20;
+    int room = bruteRoom(&pool, size, GAP, x1, y1, x2, y2);
+    int ok = entityPlace(&pool, size, GAP, x1, y1, x2, y2, rnd, &x, &y);
+    clear += ok;
+    placed++;
+    if (room) {
+      clearPossible++;
+      clearFound += ok;
+    }
+    entitySpawn(&pool, rnd(0, 2), x, y, size, TAP_MARGIN, 0);
+  }
+  for (int i = 0; i < 4096; i++) {
+    tapX[i] = rnd(0, FIELD_W);
+    tapY[i] = rnd(0, FIELD_H);
+  }
+
+  double t0 = nowNs();
+  for (unsigned i = 0; i < opt.taps; i++) sink += entityHit(&pool, tapX[i & 4095], tapY[i & 4095], now);
+  double gridNs = (nowNs() - t0) / opt.taps;
+
+  t0 = nowNs();
+  for (unsigned i = 0; i < opt.taps; i++) sink += linearHit(&pool, tapX[i & 4095], tapY[i & 4095]);
+  double linearNs = (nowNs() - t0) / opt.taps;
+
+  // Despawn one, place and spawn a replacement: what a spawn timer does
+  unsigned cycles = opt.taps / 10 + 1;
+  t0 = nowNs();
+  for (unsigned i = 0; i < cycles; i++) {
+    int size = 40, x, y;
+    entityDespawn(&pool, pool.live[i % pool.liveCount], now, 0);
+    entityPlace(&pool, size, GAP, size + 20, 40 + size,
+                FIELD_W - size - 20, FIELD_H - size - 20, rnd, &x, &y);
+    entitySpawn(&pool, 0, x, y, size, TAP_MARGIN, 0);
+  }
+  double cycleNs = (nowNs() - t0) / cycles;
+
+  printf("  %2d targets   tap %6.1f ns (linear %6.1f ns)   respawn %7.1f ns   %3d%% placed clear\n",
+         targets, gridNs, linearNs, cycleNs, placed ? clear * 100 / placed : 100);
+  (void)sink;
+}
+
+int main(int argc, char **argv) {
+  parseArgs(argc, argv);
+  rngState = opt.seed ? opt.seed : 1;
+
+  checkPool();
+
+  entityInit(&pool, FIELD_W, FIELD_H, MAX_SIZE + 2 * TAP_MARGIN);
+  printf("BONK entity pool bench - %dx%d playfield, %d slots, %dx%d grid of %d px\n",
+         FIELD_W, FIELD_H, ENTITY_MAX, pool.cols, pool.rows, pool.cellSize);
+  printf("\n");
+  printf("  known answers       %s (%u random operations)\n", failures ? "FAILED" : "ok", opt.rounds);
+  printf("\n");
+  timePopulation(2);
+  timePopulation(8);
+  timePopulation(16);
+  timePopulation(32);
+  timePopulation(ENTITY_MAX);
+
+  printf("\n  clear spots found   %d of %d placements that had one\n", clearFound, clearPossible);
+  expect(clearFound == clearPossible, "placement missed a clear spot");
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Arduino.h - Host stand-in for the Teensy core
+ *
+ * Just enough of the Arduino API for the BONK sketches to compile and run
+ * unchanged on Linux. Time comes from a virtual clock that only moves when
+ * the sketch calls delay() or the harness advances it, random() is a
+ * seedable PRNG, and pins/interrupts are simulated so the harness can drive
+ * the touch controllers. See host_hw.h for the harness side.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+#define PROGMEM
+#define DMAMEM
+#define FLASHMEM
+
+#define HIGH          1
+#define LOW           0
+
+#define INPUT         0
+#define OUTPUT        1
+#define INPUT_PULLUP  2
+
+#define CHANGE        4
+#define FALLING       2
+#define RISING        3
+
+#define DEC           10
+#define HEX           16
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+using std::min;
+using std::max;
+
+template <typename T, typename L, typename H>
+inline T constrain(T v, L lo, H hi) { return v < lo ? (T)lo : (v > hi ? (T)hi : v); }
+
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Time (virtual clock)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// "wfi": sleeps the virtual core until the next 1 ms SysTick or the next
+// hardware event, whichever comes first
+void hostWaitForInterrupt();
+#define WAIT_FOR_INTERRUPT() hostWaitForInterrupt()
+
+// Random (seedable, platform independent)
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// Pins and interrupts
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t irq, void (*fn)(), int mode);
+void detachInterrupt(uint8_t irq);
+inline void noInterrupts() {}
+inline void interrupts() {}
+
+// Audio is not simulated
+void tone(uint8_t pin, uint16_t freq, uint32_t duration = 0);
+void noTone(uint8_t pin);
+
+class String : public std::string {
+public:
+  String() {}
+  String(const char *s) : std::string(s) {}
+  String(const std::string &s) : std::string(s) {}
+  String(char c) : std::string(1, c) {}
+  String(int v) : std::string(std::to_string(v)) {}
+  String(unsigned int v) : std::string(std::to_string(v)) {}
+  String(long v) : std::string(std::to_string(v)) {}
+  String(unsigned long v) : std::string(std::to_string(v)) {}
+  unsigned int length() const { return (unsigned int)size(); }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t write(const char *s) { return print(s); }
+  size_t write(const uint8_t *buf, size_t n) {
+    for (size_t i = 0; i < n; i++) write(buf[i]);
+    return n;
+  }
+
+  size_t print(const char *s) {
+    size_t n = 0;
+    while (*s) n += write((uint8_t)*s++);
+    return n;
+  }
+  size_t print(const String &s) { return print(s.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int v, int base = DEC) { return printNumber((long)v, base); }
+  size_t print(unsigned int v, int base = DEC) { return printNumber((unsigned long)v, base); }
+  size_t print(long v, int base = DEC) { return printNumber(v, base); }
+  size_t print(unsigned long v, int base = DEC) { return printNumber(v, base); }
+  size_t print(double v, int digits = 2) {
+    char buf[48];
+    snprintf(buf, sizeof(buf), "%.*f", digits, v);
+    return print(buf);
+  }
+
+  size_t println() { return print("\r\n"); }
+  template <typename T>
+  size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T>
+  size_t println(T v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+private:
+  size_t printNumber(long v, int base) {
+    if (base == DEC) {
+      char buf[24];
+      snprintf(buf, sizeof(buf), "%ld", v);
+      return print(buf);
+    }
+    return printNumber((unsigned long)v, base);
+  }
+  size_t printNumber(unsigned long v, int base) {
+    char buf[24];
+    snprintf(buf, sizeof(buf), base == HEX ? "%lX" : "%lu", v);
+    return print(buf);
+  }
+};
+
+// USB serial - output is counted, optionally echoed to stderr or captured,
+// and drains from a transmit buffer at the begin() baud rate
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud);
+  size_t write(uint8_t c);
+  using Print::write;
+  int availableForWrite();
+  int available() { return 0; }
+  int read() { return -1; }
+  void flush() {}
+  operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_ARDUINO_H
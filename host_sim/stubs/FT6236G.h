@@ -0,0 +1,14 @@
+/*
+ * FT6236G.h - Host stand-in for the FT6236G library
+ *
+ * REV8 talks to the controller over Wire directly and only declares an
+ * instance, so the class is empty. The controller itself is simulated
+ * behind Wire (see host_hw.h).
+ */
+
+#ifndef HOST_FT6236G_H
+#define HOST_FT6236G_H
+
+class FT6236G {};
+
+#endif // HOST_FT6236G_H
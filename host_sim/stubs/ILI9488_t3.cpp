@@ -0,0 +1,438 @@
+/*
+ * ILI9488_t3.cpp - Host stand-in for the ILI9488_t3 display driver
+ *
+ * The rasterization matches ILI9488_t3 / Adafruit_GFX (and so the REV8
+ * compositor), and every call is costed the way the real driver would
+ * drive the bus: one address window per pixel, run or rectangle it emits.
+ */
+
+#include "ILI9488_t3.h"
+#include "host_hw.h"
+
+#define WINDOW_OVERHEAD  11   // CASET + 4, PASET + 4, RAMWR
+#define BYTES_PER_PIXEL  3    // 18-bit color over SPI
+
+extern "C" const unsigned char glcdfont[];
+
+HostPanelStats hostPanelStats;
+static const ILI9488_t3 *activePanel = NULL;
+
+const uint16_t *hostPanelPixels(int *width, int *height) {
+  if (!activePanel) return NULL;
+  *width = activePanel->width();
+  *height = activePanel->height();
+  return activePanel->pixels();
+}
+
+static void swapInt(int16_t &a, int16_t &b) { int16_t t = a; a = b; b = t; }
+
+ILI9488_t3::ILI9488_t3(uint8_t, uint8_t, uint8_t, uint8_t, uint8_t, uint8_t) {
+  memset(fb, 0, sizeof(fb));
+}
+
+void ILI9488_t3::begin() {
+  activePanel = this;
+  rotation = 0;
+  _width = ILI9488_TFTWIDTH;
+  _height = ILI9488_TFTHEIGHT;
+  memset(fb, 0, sizeof(fb));
+}
+
+void ILI9488_t3::setRotation(uint8_t r) {
+  rotation = r & 3;
+  bool landscape = rotation & 1;
+  _width = landscape ? ILI9488_TFTHEIGHT : ILI9488_TFTWIDTH;
+  _height = landscape ? ILI9488_TFTWIDTH : ILI9488_TFTHEIGHT;
+  hostPanelStats.spiBytes += 2;  // MADCTL
+}
+
+// ==================== RASTER HELPERS ====================
+
+void ILI9488_t3::window(uint32_t pixels) {
+  hostPanelStats.windows++;
+  hostPanelStats.pixels += pixels;
+  hostPanelStats.spiBytes += WINDOW_OVERHEAD + pixels * BYTES_PER_PIXEL;
+}
+
+void ILI9488_t3::pixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  fb[(int32_t)y * _width + x] = color;
+  window(1);
+}
+
+void ILI9488_t3::hline(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  if (y < 0 || y >= _height || x >= _width || w <= 0) return;
+  if (x < 0) { w += x; x = 0; }
+  if (x + w > _width) w = _width - x;
+  if (w <= 0) return;
+  uint16_t *p = &fb[(int32_t)y * _width + x];
+  for (int16_t i = 0; i < w; i++) p[i] = color;
+  window(w);
+}
+
+void ILI9488_t3::vline(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  if (x < 0 || x >= _width || y >= _height || h <= 0) return;
+  if (y < 0) { h += y; y = 0; }
+  if (y + h > _height) h = _height - y;
+  if (h <= 0) return;
+  uint16_t *p = &fb[(int32_t)y * _width + x];
+  for (int16_t j = 0; j < h; j++, p += _width) *p = color;
+  window(h);
+}
+
+void ILI9488_t3::rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  if (x >= _width || y >= _height || w <= 0 || h <= 0) return;
+  if (x < 0) { w += x; x = 0; }
+  if (y < 0) { h += y; y = 0; }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0) return;
+  for (int16_t j = 0; j < h; j++) {
+    uint16_t *p = &fb[(int32_t)(y + j) * _width + x];
+    for (int16_t i = 0; i < w; i++) p[i] = color;
+  }
+  window((uint32_t)w * h);
+}
+
+// ==================== PRIMITIVES ====================
+
+void ILI9488_t3::fillScreen(uint16_t color) {
+  hostPanelStats.primitives++;
+  rect(0, 0, _width, _height, color);
+}
+
+void ILI9488_t3::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  hostPanelStats.primitives++;
+  pixel(x, y, color);
+}
+
+void ILI9488_t3::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  hostPanelStats.primitives++;
+  hline(x, y, w, color);
+}
+
+void ILI9488_t3::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  hostPanelStats.primitives++;
+  vline(x, y, h, color);
+}
+
+void ILI9488_t3::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  hostPanelStats.primitives++;
+  rect(x, y, w, h, color);
+}
+
+void ILI9488_t3::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  hostPanelStats.primitives++;
+  hline(x, y, w, color);
+  hline(x, y + h - 1, w, color);
+  vline(x, y, h, color);
+  vline(x + w - 1, y, h, color);
+}
+
+void ILI9488_t3::writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors) {
+  hostPanelStats.primitives++;
+  if (w <= 0 || h <= 0) return;
+  uint32_t written = 0;
+  for (int16_t j = 0; j < h; j++) {
+    int16_t py = y + j;
+    for (int16_t i = 0; i < w; i++) {
+      int16_t px = x + i;
+      if (px < 0 || py < 0 || px >= _width || py >= _height) continue;
+      fb[(int32_t)py * _width + px] = pcolors[(int32_t)j * w + i];
+      written++;
+    }
+  }
+  if (written) window(written);
+}
+
+// Bresenham, emitted as horizontal/vertical runs like the t3 driver does
+void ILI9488_t3::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  hostPanelStats.primitives++;
+  if (y0 == y1) {
+    if (x1 > x0) hline(x0, y0, x1 - x0 + 1, color);
+    else hline(x1, y0, x0 - x1 + 1, color);
+    return;
+  }
+  if (x0 == x1) {
+    if (y1 > y0) vline(x0, y0, y1 - y0 + 1, color);
+    else vline(x0, y1, y0 - y1 + 1, color);
+    return;
+  }
+
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    swapInt(x0, y0);
+    swapInt(x1, y1);
+  }
+  if (x0 > x1) {
+    swapInt(x0, x1);
+    swapInt(y0, y1);
+  }
+
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t ystep = (y0 < y1) ? 1 : -1;
+  int16_t xbegin = x0;
+
+  for (; x0 <= x1; x0++) {
+    err -= dy;
+    if (err < 0) {
+      int16_t len = x0 - xbegin + 1;
+      if (steep) vline(y0, xbegin, len, color);
+      else hline(xbegin, y0, len, color);
+      xbegin = x0 + 1;
+      y0 += ystep;
+      err += dx;
+    }
+  }
+  if (x0 > xbegin) {
+    if (steep) vline(y0, xbegin, x0 - xbegin, color);
+    else hline(xbegin, y0, x0 - xbegin, color);
+  }
+}
+
+void ILI9488_t3::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  hostPanelStats.primitives++;
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  pixel(x0, y0 + r, color);
+  pixel(x0, y0 - r, color);
+  pixel(x0 + r, y0, color);
+  pixel(x0 - r, y0, color);
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    pixel(x0 + x, y0 + y, color);
+    pixel(x0 - x, y0 + y, color);
+    pixel(x0 + x, y0 - y, color);
+    pixel(x0 - x, y0 - y, color);
+    pixel(x0 + y, y0 + x, color);
+    pixel(x0 - y, y0 + x, color);
+    pixel(x0 + y, y0 - x, color);
+    pixel(x0 - y, y0 - x, color);
+  }
+}
+
+void ILI9488_t3::circleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                              int16_t delta, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddF_x = 1;
+  int16_t ddF_y = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+
+    if (corners & 0x1) {
+      vline(x0 + x, y0 - y, 2 * y + 1 + delta, color);
+      vline(x0 + y, y0 - x, 2 * x + 1 + delta, color);
+    }
+    if (corners & 0x2) {
+      vline(x0 - x, y0 - y, 2 * y + 1 + delta, color);
+      vline(x0 - y, y0 - x, 2 * x + 1 + delta, color);
+    }
+  }
+}
+
+void ILI9488_t3::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+  hostPanelStats.primitives++;
+  vline(x0, y0 - r, 2 * r + 1, color);
+  circleHelper(x0, y0, r, 3, 0, color);
+}
+
+void ILI9488_t3::drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color) {
+  hostPanelStats.primitives++;
+  if (rx < 2 || ry < 2) return;
+  int32_t rx2 = (int32_t)rx * rx, ry2 = (int32_t)ry * ry;
+  int32_t fx2 = 4 * rx2, fy2 = 4 * ry2;
+  int32_t s;
+  int16_t x, y;
+
+  for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
+    pixel(x0 + x, y0 + y, color);
+    pixel(x0 - x, y0 + y, color);
+    pixel(x0 - x, y0 - y, color);
+    pixel(x0 + x, y0 - y, color);
+    if (s >= 0) {
+      s += fx2 * (1 - y);
+      y--;
+    }
+    s += ry2 * ((4 * x) + 6);
+  }
+
+  for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
+    pixel(x0 + x, y0 + y, color);
+    pixel(x0 - x, y0 + y, color);
+    pixel(x0 - x, y0 - y, color);
+    pixel(x0 + x, y0 - y, color);
+    if (s >= 0) {
+      s += fy2 * (1 - x);
+      x--;
+    }
+    s += rx2 * ((4 * y) + 6);
+  }
+}
+
+void ILI9488_t3::fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color) {
+  hostPanelStats.primitives++;
+  if (rx < 2 || ry < 2) return;
+  int32_t rx2 = (int32_t)rx * rx, ry2 = (int32_t)ry * ry;
+  int32_t fx2 = 4 * rx2, fy2 = 4 * ry2;
+  int32_t s;
+  int16_t x, y;
+
+  for (x = 0, y = ry, s = 2 * ry2 + rx2 * (1 - 2 * ry); ry2 * x <= rx2 * y; x++) {
+    hline(x0 - x, y0 - y, x + x + 1, color);
+    hline(x0 - x, y0 + y, x + x + 1, color);
+    if (s >= 0) {
+      s += fx2 * (1 - y);
+      y--;
+    }
+    s += ry2 * ((4 * x) + 6);
+  }
+
+  for (x = rx, y = 0, s = 2 * rx2 + ry2 * (1 - 2 * rx); rx2 * y <= ry2 * x; y++) {
+    hline(x0 - x, y0 - y, x + x + 1, color);
+    hline(x0 - x, y0 + y, x + x + 1, color);
+    if (s >= 0) {
+      s += fy2 * (1 - x);
+      x--;
+    }
+    s += rx2 * ((4 * y) + 6);
+  }
+}
+
+void ILI9488_t3::drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                              int16_t x2, int16_t y2, uint16_t color) {
+  drawLine(x0, y0, x1, y1, color);
+  drawLine(x1, y1, x2, y2, color);
+  drawLine(x2, y2, x0, y0, color);
+  hostPanelStats.primitives -= 2;
+}
+
+void ILI9488_t3::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                              int16_t x2, int16_t y2, uint16_t color) {
+  hostPanelStats.primitives++;
+  int16_t a, b, y, last;
+
+  // Sort coordinates by Y order (y2 >= y1 >= y0)
+  if (y0 > y1) { swapInt(y0, y1); swapInt(x0, x1); }
+  if (y1 > y2) { swapInt(y2, y1); swapInt(x2, x1); }
+  if (y0 > y1) { swapInt(y0, y1); swapInt(x0, x1); }
+
+  if (y0 == y2) {
+    a = b = x0;
+    if (x1 < a) a = x1;
+    else if (x1 > b) b = x1;
+    if (x2 < a) a = x2;
+    else if (x2 > b) b = x2;
+    hline(a, y0, b - a + 1, color);
+    return;
+  }
+
+  int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+  int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+  int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+
+  last = (y1 == y2) ? y1 : y1 - 1;
+
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b) swapInt(a, b);
+    hline(a, y, b - a + 1, color);
+  }
+
+  sa = dx12 * (y - y1);
+  sb = dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b) swapInt(a, b);
+    hline(a, y, b - a + 1, color);
+  }
+}
+
+// ==================== TEXT ====================
+
+size_t ILI9488_t3::write(uint8_t c) {
+  if (c == '\n') {
+    cursorY += textSize * 8;
+    cursorX = 0;
+  } else if (c != '\r') {
+    if (wrap && cursorX + textSize * 6 > _width) {
+      cursorY += textSize * 8;
+      cursorX = 0;
+    }
+    drawChar(cursorX, cursorY, c, textColor, textBgColor, textSize);
+    cursorX += textSize * 6;
+  }
+  return 1;
+}
+
+// Transparent text goes out as one window per run of lit pixels in each
+// glyph row; opaque text is a single 6x8 block, as in the t3 driver
+void ILI9488_t3::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                          uint16_t bg, uint8_t size) {
+  hostPanelStats.primitives++;
+  if (x >= _width || y >= _height || x + 6 * size - 1 < 0 || y + 8 * size - 1 < 0) return;
+
+  if (color != bg) {
+    for (int8_t i = 0; i < 6; i++) {
+      uint8_t column = (i < 5) ? glcdfont[c * 5 + i] : 0;
+      for (int8_t j = 0; j < 8; j++, column >>= 1) {
+        uint16_t pc = (column & 1) ? color : bg;
+        for (uint8_t sy = 0; sy < size; sy++) {
+          for (uint8_t sx = 0; sx < size; sx++) {
+            int16_t px = x + i * size + sx, py = y + j * size + sy;
+            if (px >= 0 && py >= 0 && px < _width && py < _height) {
+              fb[(int32_t)py * _width + px] = pc;
+            }
+          }
+        }
+      }
+    }
+    window(48UL * size * size);
+    return;
+  }
+
+  for (int8_t j = 0; j < 8; j++) {
+    int8_t i = 0;
+    while (i < 5) {
+      if (!(glcdfont[c * 5 + i] & (1 << j))) {
+        i++;
+        continue;
+      }
+      int8_t run = 1;
+      while (i + run < 5 && (glcdfont[c * 5 + i + run] & (1 << j))) run++;
+      rect(x + i * size, y + j * size, run * size, size, color);
+      i += run;
+    }
+  }
+}
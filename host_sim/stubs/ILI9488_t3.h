@@ -0,0 +1,83 @@
+/*
+ * ILI9488_t3.h - Host stand-in for the ILI9488_t3 display driver
+ *
+ * Rasterizes into an RGB565 framebuffer using the same algorithms as
+ * ILI9488_t3 / Adafruit_GFX, and counts what the real driver would have put
+ * on the SPI bus: every primitive opens one or more address windows
+ * (11 bytes each) and every pixel costs 3 bytes, because the ILI9488 only
+ * takes 18-bit color over SPI.
+ *
+ * Counters are global (HostPanelStats in host_hw.h) because the sketches
+ * only ever create one panel.
+ */
+
+#ifndef HOST_ILI9488_T3_H
+#define HOST_ILI9488_T3_H
+
+#include "Arduino.h"
+
+#define ILI9488_TFTWIDTH   320
+#define ILI9488_TFTHEIGHT  480
+
+class ILI9488_t3 : public Print {
+public:
+  ILI9488_t3(uint8_t cs, uint8_t dc, uint8_t rst = 255,
+             uint8_t mosi = 11, uint8_t sclk = 13, uint8_t miso = 12);
+
+  void begin();
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void fillScreen(uint16_t color);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void drawEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color);
+  void fillEllipse(int16_t x0, int16_t y0, int16_t rx, int16_t ry, uint16_t color);
+  void drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                    int16_t x2, int16_t y2, uint16_t color);
+  void writeRect(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *pcolors);
+
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  void setTextColor(uint16_t c) { textColor = textBgColor = c; }
+  void setTextColor(uint16_t c, uint16_t bg) { textColor = c; textBgColor = bg; }
+  void setTextSize(uint8_t s) { textSize = s > 0 ? s : 1; }
+  void setTextWrap(bool w) { wrap = w; }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size);
+  size_t write(uint8_t c);
+  using Print::write;
+
+  // Host only: current panel contents, row-major, width() x height()
+  const uint16_t *pixels() const { return fb; }
+
+private:
+  uint16_t fb[ILI9488_TFTWIDTH * ILI9488_TFTHEIGHT];
+  uint8_t rotation = 0;
+  int16_t _width = ILI9488_TFTWIDTH, _height = ILI9488_TFTHEIGHT;
+
+  int16_t cursorX = 0, cursorY = 0;
+  uint16_t textColor = 0xFFFF, textBgColor = 0xFFFF;
+  uint8_t textSize = 1;
+  bool wrap = true;
+
+  // Raster helpers - no primitive counting, window/pixel accounting only
+  void window(uint32_t pixels);
+  void hline(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void vline(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void rect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void pixel(int16_t x, int16_t y, uint16_t color);
+  void circleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                    int16_t delta, uint16_t color);
+};
+
+#endif // HOST_ILI9488_T3_H
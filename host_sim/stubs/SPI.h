@@ -0,0 +1,23 @@
+/*
+ * SPI.h - Host stand-in for the Teensy SPI master
+ *
+ * transfer() talks to the simulated XPT2046 resistive touch controller
+ * (see host_hw.h). Display traffic is accounted for by the ILI9488_t3
+ * stand-in instead.
+ */
+
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+#include "Arduino.h"
+
+class SPIClass {
+public:
+  void begin() {}
+  void end() {}
+  uint8_t transfer(uint8_t b);
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,45 @@
+/*
+ * Wire.h - Host stand-in for the Teensy I2C master
+ *
+ * Transactions are routed to the simulated FT6236 (see host_hw.h); any
+ * other address NACKs.
+ */
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+  void begin() {}
+  void end() {}
+  void setClock(uint32_t hz) { clockHz = hz; }
+
+  void beginTransmission(uint8_t addr);
+  size_t write(uint8_t b);
+  uint8_t endTransmission(bool sendStop = true);
+
+  uint8_t requestFrom(uint8_t addr, uint8_t count);
+  uint8_t requestFrom(int addr, int count) { return requestFrom((uint8_t)addr, (uint8_t)count); }
+  int available() { return rxLen - rxPos; }
+  int read() { return rxPos < rxLen ? rxBuf[rxPos++] : -1; }
+
+  // Bytes clocked over the bus, for the harness
+  uint32_t busBytes() const { return bytesMoved; }
+  uint32_t clock() const { return clockHz; }
+
+private:
+  uint8_t txAddr = 0;
+  uint8_t txBuf[32];
+  uint8_t txLen = 0;
+  uint8_t rxBuf[32];
+  uint8_t rxLen = 0;
+  uint8_t rxPos = 0;
+  uint32_t clockHz = 100000;
+  uint32_t bytesMoved = 0;
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
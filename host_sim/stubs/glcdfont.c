@@ -0,0 +1,104 @@
+/*
+ * glcdfont.c - Classic 5x7 font used by ILI9488_t3 / Adafruit_GFX
+ *
+ * Printable ASCII only (0x20-0x7E); every other code draws as a blank cell.
+ * Five column bytes per glyph, least significant bit at the top.
+ */
+
+const unsigned char glcdfont[256 * 5] = {
+  [0x20 * 5] = 0x00, 0x00, 0x00, 0x00, 0x00,  // ' '
+  [0x21 * 5] = 0x00, 0x00, 0x5F, 0x00, 0x00,  // '!'
+  [0x22 * 5] = 0x00, 0x07, 0x00, 0x07, 0x00,  // '"'
+  [0x23 * 5] = 0x14, 0x7F, 0x14, 0x7F, 0x14,  // '#'
+  [0x24 * 5] = 0x24, 0x2A, 0x7F, 0x2A, 0x12,  // '$'
+  [0x25 * 5] = 0x23, 0x13, 0x08, 0x64, 0x62,  // '%'
+  [0x26 * 5] = 0x36, 0x49, 0x56, 0x20, 0x50,  // '&'
+  [0x27 * 5] = 0x00, 0x08, 0x07, 0x03, 0x00,  // '''
+  [0x28 * 5] = 0x00, 0x1C, 0x22, 0x41, 0x00,  // '('
+  [0x29 * 5] = 0x00, 0x41, 0x22, 0x1C, 0x00,  // ')'
+  [0x2A * 5] = 0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  // '*'
+  [0x2B * 5] = 0x08, 0x08, 0x3E, 0x08, 0x08,  // '+'
+  [0x2C * 5] = 0x00, 0x80, 0x70, 0x30, 0x00,  // ','
+  [0x2D * 5] = 0x08, 0x08, 0x08, 0x08, 0x08,  // '-'
+  [0x2E * 5] = 0x00, 0x00, 0x60, 0x60, 0x00,  // '.'
+  [0x2F * 5] = 0x20, 0x10, 0x08, 0x04, 0x02,  // '/'
+  [0x30 * 5] = 0x3E, 0x51, 0x49, 0x45, 0x3E,  // '0'
+  [0x31 * 5] = 0x00, 0x42, 0x7F, 0x40, 0x00,  // '1'
+  [0x32 * 5] = 0x72, 0x49, 0x49, 0x49, 0x46,  // '2'
+  [0x33 * 5] = 0x21, 0x41, 0x49, 0x4D, 0x33,  // '3'
+  [0x34 * 5] = 0x18, 0x14, 0x12, 0x7F, 0x10,  // '4'
+  [0x35 * 5] = 0x27, 0x45, 0x45, 0x45, 0x39,  // '5'
+  [0x36 * 5] = 0x3C, 0x4A, 0x49, 0x49, 0x31,  // '6'
+  [0x37 * 5] = 0x41, 0x21, 0x11, 0x09, 0x07,  // '7'
+  [0x38 * 5] = 0x36, 0x49, 0x49, 0x49, 0x36,  // '8'
+  [0x39 * 5] = 0x46, 0x49, 0x49, 0x29, 0x1E,  // '9'
+  [0x3A * 5] = 0x00, 0x00, 0x14, 0x00, 0x00,  // ':'
+  [0x3B * 5] = 0x00, 0x40, 0x34, 0x00, 0x00,  // ';'
+  [0x3C * 5] = 0x00, 0x08, 0x14, 0x22, 0x41,  // '<'
+  [0x3D * 5] = 0x14, 0x14, 0x14, 0x14, 0x14,  // '='
+  [0x3E * 5] = 0x00, 0x41, 0x22, 0x14, 0x08,  // '>'
+  [0x3F * 5] = 0x02, 0x01, 0x59, 0x09, 0x06,  // '?'
+  [0x40 * 5] = 0x3E, 0x41, 0x5D, 0x59, 0x4E,  // '@'
+  [0x41 * 5] = 0x7C, 0x12, 0x11, 0x12, 0x7C,  // 'A'
+  [0x42 * 5] = 0x7F, 0x49, 0x49, 0x49, 0x36,  // 'B'
+  [0x43 * 5] = 0x3E, 0x41, 0x41, 0x41, 0x22,  // 'C'
+  [0x44 * 5] = 0x7F, 0x41, 0x41, 0x41, 0x3E,  // 'D'
+  [0x45 * 5] = 0x7F, 0x49, 0x49, 0x49, 0x41,  // 'E'
+  [0x46 * 5] = 0x7F, 0x09, 0x09, 0x09, 0x01,  // 'F'
+  [0x47 * 5] = 0x3E, 0x41, 0x41, 0x51, 0x73,  // 'G'
+  [0x48 * 5] = 0x7F, 0x08, 0x08, 0x08, 0x7F,  // 'H'
+  [0x49 * 5] = 0x00, 0x41, 0x7F, 0x41, 0x00,  // 'I'
+  [0x4A * 5] = 0x20, 0x40, 0x41, 0x3F, 0x01,  // 'J'
+  [0x4B * 5] = 0x7F, 0x08, 0x14, 0x22, 0x41,  // 'K'
+  [0x4C * 5] = 0x7F, 0x40, 0x40, 0x40, 0x40,  // 'L'
+  [0x4D * 5] = 0x7F, 0x02, 0x1C, 0x02, 0x7F,  // 'M'
+  [0x4E * 5] = 0x7F, 0x04, 0x08, 0x10, 0x7F,  // 'N'
+  [0x4F * 5] = 0x3E, 0x41, 0x41, 0x41, 0x3E,  // 'O'
+  [0x50 * 5] = 0x7F, 0x09, 0x09, 0x09, 0x06,  // 'P'
+  [0x51 * 5] = 0x3E, 0x41, 0x51, 0x21, 0x5E,  // 'Q'
+  [0x52 * 5] = 0x7F, 0x09, 0x19, 0x29, 0x46,  // 'R'
+  [0x53 * 5] = 0x26, 0x49, 0x49, 0x49, 0x32,  // 'S'
+  [0x54 * 5] = 0x03, 0x01, 0x7F, 0x01, 0x03,  // 'T'
+  [0x55 * 5] = 0x3F, 0x40, 0x40, 0x40, 0x3F,  // 'U'
+  [0x56 * 5] = 0x1F, 0x20, 0x40, 0x20, 0x1F,  // 'V'
+  [0x57 * 5] = 0x3F, 0x40, 0x38, 0x40, 0x3F,  // 'W'
+  [0x58 * 5] = 0x63, 0x14, 0x08, 0x14, 0x63,  // 'X'
+  [0x59 * 5] = 0x03, 0x04, 0x78, 0x04, 0x03,  // 'Y'
+  [0x5A * 5] = 0x61, 0x59, 0x49, 0x4D, 0x43,  // 'Z'
+  [0x5B * 5] = 0x00, 0x7F, 0x41, 0x41, 0x41,  // '['
+  [0x5C * 5] = 0x02, 0x04, 0x08, 0x10, 0x20,  // '\\'
+  [0x5D * 5] = 0x00, 0x41, 0x41, 0x41, 0x7F,  // ']'
+  [0x5E * 5] = 0x04, 0x02, 0x01, 0x02, 0x04,  // '^'
+  [0x5F * 5] = 0x40, 0x40, 0x40, 0x40, 0x40,  // '_'
+  [0x60 * 5] = 0x00, 0x03, 0x07, 0x08, 0x00,  // '`'
+  [0x61 * 5] = 0x20, 0x54, 0x54, 0x78, 0x40,  // 'a'
+  [0x62 * 5] = 0x7F, 0x28, 0x44, 0x44, 0x38,  // 'b'
+  [0x63 * 5] = 0x38, 0x44, 0x44, 0x44, 0x28,  // 'c'
+  [0x64 * 5] = 0x38, 0x44, 0x44, 0x28, 0x7F,  // 'd'
+  [0x65 * 5] = 0x38, 0x54, 0x54, 0x54, 0x18,  // 'e'
+  [0x66 * 5] = 0x00, 0x08, 0x7E, 0x09, 0x02,  // 'f'
+  [0x67 * 5] = 0x18, 0xA4, 0xA4, 0x9C, 0x78,  // 'g'
+  [0x68 * 5] = 0x7F, 0x08, 0x04, 0x04, 0x78,  // 'h'
+  [0x69 * 5] = 0x00, 0x44, 0x7D, 0x40, 0x00,  // 'i'
+  [0x6A * 5] = 0x20, 0x40, 0x40, 0x3D, 0x00,  // 'j'
+  [0x6B * 5] = 0x7F, 0x10, 0x28, 0x44, 0x00,  // 'k'
+  [0x6C * 5] = 0x00, 0x41, 0x7F, 0x40, 0x00,  // 'l'
+  [0x6D * 5] = 0x7C, 0x04, 0x78, 0x04, 0x78,  // 'm'
+  [0x6E * 5] = 0x7C, 0x08, 0x04, 0x04, 0x78,  // 'n'
+  [0x6F * 5] = 0x38, 0x44, 0x44, 0x44, 0x38,  // 'o'
+  [0x70 * 5] = 0xFC, 0x18, 0x24, 0x24, 0x18,  // 'p'
+  [0x71 * 5] = 0x18, 0x24, 0x24, 0x18, 0xFC,  // 'q'
+  [0x72 * 5] = 0x7C, 0x08, 0x04, 0x04, 0x08,  // 'r'
+  [0x73 * 5] = 0x48, 0x54, 0x54, 0x54, 0x24,  // 's'
+  [0x74 * 5] = 0x04, 0x04, 0x3F, 0x44, 0x24,  // 't'
+  [0x75 * 5] = 0x3C, 0x40, 0x40, 0x20, 0x7C,  // 'u'
+  [0x76 * 5] = 0x1C, 0x20, 0x40, 0x20, 0x1C,  // 'v'
+  [0x77 * 5] = 0x3C, 0x40, 0x30, 0x40, 0x3C,  // 'w'
+  [0x78 * 5] = 0x44, 0x28, 0x10, 0x28, 0x44,  // 'x'
+  [0x79 * 5] = 0x4C, 0x90, 0x90, 0x90, 0x7C,  // 'y'
+  [0x7A * 5] = 0x44, 0x64, 0x54, 0x4C, 0x44,  // 'z'
+  [0x7B * 5] = 0x00, 0x08, 0x36, 0x41, 0x00,  // '{'
+  [0x7C * 5] = 0x00, 0x00, 0x77, 0x00, 0x00,  // '|'
+  [0x7D * 5] = 0x00, 0x41, 0x36, 0x08, 0x00,  // '}'
+  [0x7E * 5] = 0x02, 0x01, 0x02, 0x04, 0x02,  // '~'
+};
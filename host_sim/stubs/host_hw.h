@@ -0,0 +1,75 @@
+/*
+ * host_hw.h - Harness side of the simulated Teensy
+ *
+ * The sketch only ever sees the Arduino API; the harness uses these hooks
+ * to move the virtual clock, feed the touch controllers and read back what
+ * reached the panel.
+ */
+
+#ifndef HOST_HW_H
+#define HOST_HW_H
+
+#include <stdint.h>
+
+// ==================== VIRTUAL CLOCK ====================
+
+// Current virtual time in microseconds since power-on
+uint64_t hostClock();
+
+// Move the clock forward, firing any scheduled hardware events on the way
+// so they land at their exact time even in the middle of a delay()
+void hostAdvance(uint64_t us);
+
+// Virtual time spent asleep in WAIT_FOR_INTERRUPT(), in microseconds
+uint64_t hostSleepTime();
+
+// Hardware event scheduler supplied by the harness. nextAt() returns the
+// virtual time of the next pending event (UINT64_MAX if none); fire() runs
+// every event due at or before 'now'.
+typedef uint64_t (*HostNextEventFn)();
+typedef void (*HostFireEventsFn)(uint64_t now);
+void hostSetScheduler(HostNextEventFn nextAt, HostFireEventsFn fire);
+
+// ==================== PINS / RANDOM / SERIAL ====================
+
+// Drive an input pin; fires an attached interrupt on the matching edge
+void hostSetPin(uint8_t pin, uint8_t level);
+
+// Value analogRead() returns - the sketches seed random() from it
+void hostSetAnalog(int value);
+
+// Echo Serial output to stderr and count it
+void hostSerialEcho(bool on);
+uint64_t hostSerialBytes();
+
+// Also write every Serial byte to 'path' (NULL stops); false if it can't
+// be opened
+bool hostSerialCapture(const char *path);
+
+// ==================== PANEL ====================
+
+struct HostPanelStats {
+  uint64_t primitives;  // Drawing calls made on the panel driver
+  uint64_t pixels;      // Pixels written to panel RAM
+  uint64_t spiBytes;    // Command + data bytes on the display SPI bus
+  uint64_t windows;     // Address windows opened
+};
+
+extern HostPanelStats hostPanelStats;
+
+// Framebuffer of the most recently begun panel (NULL before begin())
+const uint16_t *hostPanelPixels(int *width, int *height);
+
+// ==================== TOUCH CONTROLLERS ====================
+
+// FT6236 capacitive controller on I2C at 'addr', INT on 'intPin'.
+// Raw panel coordinates; each change pulses INT low once.
+void hostFt6236Attach(uint8_t addr, uint8_t intPin);
+void hostFt6236Touch(uint8_t id, bool down, uint16_t rawX, uint16_t rawY);
+
+// XPT2046 resistive controller on SPI with PENIRQ on 'irqPin'.
+// Raw 12-bit readings; PENIRQ is held low while touched.
+void hostXpt2046Attach(uint8_t irqPin);
+void hostXpt2046Touch(bool down, uint16_t rawX, uint16_t rawY);
+
+#endif // HOST_HW_H
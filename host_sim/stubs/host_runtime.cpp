@@ -0,0 +1,321 @@
+/*
+ * host_runtime.cpp - Simulated Teensy core for the BONK host build
+ *
+ * Virtual clock, seedable random(), pins with edge interrupts, Serial, and
+ * the two touch controllers the sketches talk to: an FT6236 behind Wire
+ * (REV8) and an XPT2046 behind SPI (v9).
+ */
+
+#include "Arduino.h"
+#include "Wire.h"
+#include "SPI.h"
+#include "host_hw.h"
+
+HardwareSerial Serial;
+TwoWire Wire;
+SPIClass SPI;
+
+// ==================== VIRTUAL CLOCK ====================
+
+static uint64_t nowUs = 0;
+static uint64_t sleptUs = 0;
+static HostNextEventFn schedNext = NULL;
+static HostFireEventsFn schedFire = NULL;
+
+uint64_t hostClock() { return nowUs; }
+uint64_t hostSleepTime() { return sleptUs; }
+
+void hostSetScheduler(HostNextEventFn nextAt, HostFireEventsFn fire) {
+  schedNext = nextAt;
+  schedFire = fire;
+}
+
+void hostAdvance(uint64_t us) {
+  uint64_t target = nowUs + us;
+  if (schedNext) {
+    uint64_t next;
+    while ((next = schedNext()) <= target) {
+      if (next > nowUs) nowUs = next;
+      schedFire(nowUs);
+    }
+  }
+  nowUs = target;
+}
+
+// Teensy's counters are 32 bits wide and wrap like the real thing
+unsigned long millis() { return (uint32_t)(nowUs / 1000); }
+unsigned long micros() { return (uint32_t)nowUs; }
+void delay(unsigned long ms) { hostAdvance((uint64_t)ms * 1000); }
+void delayMicroseconds(unsigned int us) { hostAdvance(us); }
+void yield() {}
+
+void hostWaitForInterrupt() {
+  uint64_t wake = (nowUs / 1000 + 1) * 1000;  // SysTick
+  if (schedNext) {
+    uint64_t next = schedNext();
+    if (next > nowUs && next < wake) wake = next;
+  }
+  sleptUs += wake - nowUs;
+  hostAdvance(wake - nowUs);
+}
+
+// ==================== RANDOM ====================
+
+// xorshift32 - same sequence on every host, unlike rand()
+static uint32_t randomState = 1;
+
+static uint32_t nextRandom() {
+  uint32_t x = randomState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  randomState = x;
+  return x;
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = (uint32_t)seed;
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return nextRandom() % (uint32_t)howbig;
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+// ==================== PINS ====================
+
+#define HOST_PINS 64
+
+static uint8_t pinLevel[HOST_PINS];
+static void (*pinIsr[HOST_PINS])();
+static int pinIsrMode[HOST_PINS];
+static int analogValue = 0;
+
+static struct PinInit {
+  PinInit() { memset(pinLevel, HIGH, sizeof(pinLevel)); }
+} pinInit;
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+
+int digitalRead(uint8_t pin) { return pin < HOST_PINS ? pinLevel[pin] : LOW; }
+
+int analogRead(uint8_t) { return analogValue; }
+void hostSetAnalog(int value) { analogValue = value; }
+
+void attachInterrupt(uint8_t irq, void (*fn)(), int mode) {
+  if (irq >= HOST_PINS) return;
+  pinIsr[irq] = fn;
+  pinIsrMode[irq] = mode;
+}
+
+void detachInterrupt(uint8_t irq) {
+  if (irq < HOST_PINS) pinIsr[irq] = NULL;
+}
+
+void hostSetPin(uint8_t pin, uint8_t level) {
+  if (pin >= HOST_PINS) return;
+  uint8_t old = pinLevel[pin];
+  pinLevel[pin] = level;
+  if (!pinIsr[pin] || old == level) return;
+  int mode = pinIsrMode[pin];
+  if (mode == CHANGE || (mode == FALLING && level == LOW) || (mode == RISING && level == HIGH)) {
+    pinIsr[pin]();
+  }
+}
+
+void tone(uint8_t, uint16_t, uint32_t) {}
+void noTone(uint8_t) {}
+
+// ==================== SERIAL ====================
+
+// Bytes write() takes without blocking; about one Teensy 4 USB packet
+// buffer. Writes past it are still accepted, they just aren't reported
+// as room by availableForWrite().
+#define SERIAL_TX_BUFFER 2048
+
+static bool serialEcho = false;
+static FILE *serialCapture = NULL;
+static uint64_t serialBytes = 0;
+static unsigned long serialBaud = 9600;
+static uint64_t serialQueued = 0;     // Bytes still in the transmit buffer
+static uint64_t serialDrainedAt = 0;  // Virtual us the buffer was last drained
+
+// Let the buffer empty at 10 bits per byte since the last look
+static void serialDrain() {
+  uint64_t sent = (nowUs - serialDrainedAt) * serialBaud / 10000000;
+  if (!sent) return;
+  serialQueued = sent >= serialQueued ? 0 : serialQueued - sent;
+  serialDrainedAt = nowUs;
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+  serialBaud = baud ? baud : 9600;
+  serialQueued = 0;
+  serialDrainedAt = nowUs;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  serialDrain();
+  if (serialQueued == 0) serialDrainedAt = nowUs;
+  serialQueued++;
+  serialBytes++;
+  if (serialEcho) fputc(c, stderr);
+  if (serialCapture) fputc(c, serialCapture);
+  return 1;
+}
+
+int HardwareSerial::availableForWrite() {
+  serialDrain();
+  return serialQueued >= SERIAL_TX_BUFFER ? 0 : (int)(SERIAL_TX_BUFFER - serialQueued);
+}
+
+void hostSerialEcho(bool on) { serialEcho = on; }
+uint64_t hostSerialBytes() { return serialBytes; }
+
+bool hostSerialCapture(const char *path) {
+  if (serialCapture) fclose(serialCapture);
+  serialCapture = path ? fopen(path, "wb") : NULL;
+  return !path || serialCapture;
+}
+
+// ==================== FT6236 (I2C) ====================
+
+#define FT_REG_TD_STATUS 0x02
+#define FT_EVENT_DOWN    0
+#define FT_EVENT_CONTACT 2
+
+static struct {
+  bool attached;
+  uint8_t addr;
+  uint8_t intPin;
+  uint8_t pointer;
+  uint8_t regs[256];
+  bool down[2];
+  uint8_t flag[2];
+  uint16_t x[2], y[2];
+} ft;
+
+// Lay the active touches out in TD_STATUS / P1 / P2 like the real part
+static void ftUpdateRegisters() {
+  uint8_t slot = 0;
+  memset(&ft.regs[FT_REG_TD_STATUS], 0, 13);
+  for (uint8_t id = 0; id < 2; id++) {
+    if (!ft.down[id]) continue;
+    uint8_t *p = &ft.regs[FT_REG_TD_STATUS + 1 + slot * 6];
+    p[0] = (ft.flag[id] << 6) | ((ft.x[id] >> 8) & 0x0F);
+    p[1] = ft.x[id] & 0xFF;
+    p[2] = (id << 4) | ((ft.y[id] >> 8) & 0x0F);
+    p[3] = ft.y[id] & 0xFF;
+    p[4] = 0x40;  // Weight
+    p[5] = 0x10;  // Area
+    slot++;
+  }
+  ft.regs[FT_REG_TD_STATUS] = slot;
+}
+
+void hostFt6236Attach(uint8_t addr, uint8_t intPin) {
+  memset(&ft, 0, sizeof(ft));
+  ft.attached = true;
+  ft.addr = addr;
+  ft.intPin = intPin;
+  ftUpdateRegisters();
+}
+
+void hostFt6236Touch(uint8_t id, bool down, uint16_t rawX, uint16_t rawY) {
+  if (!ft.attached || id > 1) return;
+  if (down && !ft.down[id]) ft.flag[id] = FT_EVENT_DOWN;
+  ft.down[id] = down;
+  ft.x[id] = rawX;
+  ft.y[id] = rawY;
+  ftUpdateRegisters();
+
+  // One INT pulse per new report
+  hostSetPin(ft.intPin, LOW);
+  hostSetPin(ft.intPin, HIGH);
+}
+
+void TwoWire::beginTransmission(uint8_t addr) {
+  txAddr = addr;
+  txLen = 0;
+}
+
+size_t TwoWire::write(uint8_t b) {
+  if (txLen >= sizeof(txBuf)) return 0;
+  txBuf[txLen++] = b;
+  return 1;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  bytesMoved += 1 + txLen;
+  if (!ft.attached || txAddr != ft.addr) return 2;  // Address NACK
+  if (txLen > 0) ft.pointer = txBuf[0];
+  for (uint8_t i = 1; i < txLen; i++) {
+    ft.regs[(uint8_t)(ft.pointer + i - 1)] = txBuf[i];
+  }
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t addr, uint8_t count) {
+  rxLen = rxPos = 0;
+  bytesMoved += 1;
+  if (!ft.attached || addr != ft.addr) return 0;
+  if (count > sizeof(rxBuf)) count = sizeof(rxBuf);
+  for (uint8_t i = 0; i < count; i++) {
+    rxBuf[i] = ft.regs[(uint8_t)(ft.pointer + i)];
+  }
+  rxLen = count;
+  bytesMoved += count;
+
+  // Once reported, a new touch becomes a plain contact
+  for (uint8_t id = 0; id < 2; id++) {
+    if (ft.down[id]) ft.flag[id] = FT_EVENT_CONTACT;
+  }
+  ftUpdateRegisters();
+  return count;
+}
+
+// ==================== XPT2046 (SPI) ====================
+
+static struct {
+  bool attached;
+  uint8_t irqPin;
+  bool down;
+  uint16_t x, y;
+  uint8_t channel;
+  uint8_t phase;
+} xpt;
+
+void hostXpt2046Attach(uint8_t irqPin) {
+  memset(&xpt, 0, sizeof(xpt));
+  xpt.attached = true;
+  xpt.irqPin = irqPin;
+  hostSetPin(irqPin, HIGH);
+}
+
+void hostXpt2046Touch(bool down, uint16_t rawX, uint16_t rawY) {
+  if (!xpt.attached) return;
+  xpt.down = down;
+  xpt.x = rawX;
+  xpt.y = rawY;
+  hostSetPin(xpt.irqPin, down ? LOW : HIGH);
+}
+
+// A control byte (start bit set) selects the channel; the next two
+// transfers clock out the conversion, high byte first
+uint8_t SPIClass::transfer(uint8_t b) {
+  if (!xpt.attached) return 0;
+  if (b & 0x80) {
+    xpt.channel = (b >> 4) & 0x07;
+    xpt.phase = 0;
+    return 0;
+  }
+  if (!xpt.down || xpt.phase > 1) return 0;
+  uint16_t value = (xpt.channel == 1) ? xpt.x : xpt.y;
+  return (xpt.phase++ == 0) ? (value >> 8) : (value & 0xFF);
+}
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""
+ino2cpp.py - Turn an Arduino sketch into a C++ translation unit
+
+Does what the Arduino builder does before handing a .ino to the compiler:
+includes Arduino.h and declares a prototype for every function defined at
+file scope, inserted just ahead of the first definition. #line directives
+keep compiler errors pointing at the original sketch.
+
+usage: ino2cpp.py SKETCH.ino > SKETCH.cpp
+"""
+
+import os
+import re
+import sys
+
+# Return type, name, parameter list, opening brace - at column 0 only, so
+# statements inside function bodies are never mistaken for definitions
+DEFINITION = re.compile(
+    r'^((?:(?:unsigned|signed|const|static|inline)\s+)*[A-Za-z_]\w*[\s\*&]+)'
+    r'([A-Za-z_]\w*)\s*\(([^)]*)\)\s*\{',
+    re.M)
+
+KEYWORDS = {'else', 'return', 'if', 'while', 'for', 'switch', 'do', 'case'}
+
+
+def prototypes(src):
+    protos = []
+    first = None
+    for m in DEFINITION.finditer(src):
+        ret, name, args = m.groups()
+        if ret.strip() in KEYWORDS or name in KEYWORDS:
+            continue
+        if first is None:
+            first = m.start()
+        # Default arguments belong on the first declaration only
+        args = re.sub(r'=[^,]*', '', args)
+        protos.append('%s %s(%s);' % (ret.strip(), name, ' '.join(args.split())))
+    return first, protos
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.stderr.write(__doc__.lstrip())
+        return 2
+
+    path = os.path.abspath(sys.argv[1])
+    with open(path) as f:
+        src = f.read()
+
+    first, protos = prototypes(src)
+    if first is None:
+        first = len(src)
+    line = src[:first].count('\n') + 1
+
+    out = sys.stdout
+    out.write('#include <Arduino.h>\n')
+    out.write('#line 1 "%s"\n' % path)
+    out.write(src[:first])
+    out.write('\n'.join(protos) + '\n')
+    out.write('#line %d "%s"\n' % (line, path))
+    out.write(src[first:])
+    out.write('\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""
+telemetry.py - Decode BONK REV8 binary telemetry
+
+Reads the 16-byte records telemetry.h sends (from a capture written by
+'bonk_rev8 --serial-out FILE', or straight from the Teensy's serial port)
+and prints tap-to-hit latency histograms, frame costs and a per-handler
+time breakdown.
+
+usage: telemetry.py [--events] [--strict] CAPTURE
+       telemetry.py [--events] --port /dev/ttyACM0 [--baud N] [--seconds N] [--request]
+
+--request sends a byte first, for builds with TELEMETRY_BACKGROUND 0.
+Reading a port needs pyserial. --strict exits non-zero if any bytes had
+to be skipped to find a record.
+"""
+
+import argparse
+import signal
+import struct
+import sys
+import time
+
+SYNC = 0xB5
+RECORD = 16
+
+TYPES = {
+    1: 'BOOT', 2: 'STATE', 3: 'MENU', 4: 'TOUCH', 5: 'HIT', 6: 'MISS',
+    7: 'SPAWN', 8: 'DESPAWN', 9: 'SCORE', 10: 'FRAME_BEGIN', 11: 'FRAME_END',
+    12: 'HANDLER', 13: 'ROUND_END', 14: 'CACHE', 15: 'DROPPED',
+    16: 'TOUCH_FAIL',
+}
+
+# GameState in the sketch
+STATES = [
+    'LOAD_SCREEN', 'GAME_SELECT', 'PLAYER_SELECT', 'MODE_SELECT_P1',
+    'PRESS_START_P1', 'GAMEPLAY_P1', 'MODE_SELECT_P2', 'PRESS_START_P2',
+    'GAMEPLAY_P2', 'RESULT_SCREEN',
+]
+
+# GameTimer callbacks, then HANDLER_TOUCH
+HANDLERS = [
+    'state', 'blink', 'clock', 'character', 'special', 'wander',
+    'feedback', 'plasma', 'frenzy', 'text', 'touch',
+]
+
+KINDS = ['regular', 'special']
+TOUCH_TYPES = ['down', 'move', 'up']
+GRACE = 0x80
+
+
+def name(table, i):
+    return table[i] if 0 <= i < len(table) else str(i)
+
+
+def xy(v):
+    return v & 0xFFFF, v >> 16
+
+
+# ==================== DECODING ====================
+
+def decode(data):
+    """Return [type, a, time, v1, v2] for every valid record, resyncing on
+    the sync byte and checksum, and the number of bytes skipped."""
+    records = []
+    skipped = 0
+    i = 0
+    while i + RECORD <= len(data):
+        if data[i] != SYNC or sum(data[i:i + RECORD]) & 0xFF:
+            i += 1
+            skipped += 1
+            continue
+        kind, a = data[i + 1], data[i + 2]
+        t, v1, v2 = struct.unpack_from('<III', data, i + 4)
+        records.append([kind, a, t, v1, v2])
+        i += RECORD
+    skipped += len(data) - i
+
+    # micros() is 32 bits; unwrap so times keep increasing
+    base = 0
+    last = None
+    for r in records:
+        if r[0] == 1:
+            base = 0
+            last = None
+        if last is not None and r[2] + base < last - (1 << 31):
+            base += 1 << 32
+        r[2] += base
+        last = r[2]
+    return records, skipped
+
+
+def read_port(args):
+    try:
+        import serial
+    except ImportError:
+        sys.exit('reading a port needs pyserial (pip install pyserial)')
+    port = serial.Serial(args.port, args.baud, timeout=0.1)
+    if args.request:
+        port.write(b'?')
+    data = bytearray()
+    end = time.time() + args.seconds
+    while time.time() < end:
+        data += port.read(4096)
+    port.close()
+    return bytes(data)
+
+
+# ==================== REPORTS ====================
+
+def percentile(values, p):
+    s = sorted(values)
+    return s[min(len(s) - 1, int(len(s) * p / 100))]
+
+
+def histogram(title, values, unit='us'):
+    print('\n  %s: %d samples' % (title, len(values)))
+    if not values:
+        return
+    print('    min %d  p50 %d  p90 %d  p99 %d  max %d %s' % (
+        min(values), percentile(values, 50), percentile(values, 90),
+        percentile(values, 99), max(values), unit))
+    # Power-of-two buckets
+    buckets = {}
+    for v in values:
+        b = 0
+        while (1 << b) <= v:
+            b += 1
+        buckets[b] = buckets.get(b, 0) + 1
+    peak = max(buckets.values())
+    for b in range(min(buckets), max(buckets) + 1):
+        n = buckets.get(b, 0)
+        lo = 0 if b == 0 else 1 << (b - 1)
+        hi = (1 << b) - 1
+        bar = '#' * ((n * 40 + peak - 1) // peak) if n else ''
+        print('    %8d - %-8d %6d  %s' % (lo, hi, n, bar))
+
+
+def print_events(records):
+    start = records[0][2] if records else 0
+    for kind, a, t, v1, v2 in records:
+        what = TYPES.get(kind, 'type %d' % kind)
+        if kind == 2:
+            detail = name(STATES, a)
+        elif kind == 3:
+            detail = '%s choice %d' % (name(STATES, a), v1)
+        elif kind == 4:
+            detail = '%s finger %d at %d,%d, queued %d us' % (
+                name(TOUCH_TYPES, a & 15), a >> 4, *xy(v1), v2)
+        elif kind == 5:
+            detail = '%s%s at %d,%d after %d us' % (
+                name(KINDS, a & ~GRACE), ' (grace)' if a & GRACE else '', *xy(v2), v1)
+        elif kind == 6:
+            detail = 'at %d,%d after %d us' % (*xy(v2), v1)
+        elif kind == 7:
+            detail = '%s #%d at %d,%d' % (name(KINDS, a), v1, *xy(v2))
+        elif kind == 8:
+            detail = '%s #%d' % (name(KINDS, a), v1)
+        elif kind == 9:
+            detail = 'score %d, special %d' % (v1, v2)
+        elif kind in (1, 10):
+            detail = ''
+        elif kind == 11:
+            detail = '%d bytes' % v1
+        elif kind == 12:
+            detail = '%s %d us' % (name(HANDLERS, a), v1)
+        elif kind == 13:
+            detail = '%d SPI bytes in %d frames, sprite cache %d%% hits' % (v1, v2, a)
+        elif kind == 14:
+            detail = '%d sprites, %d bytes' % (v1, v2)
+        elif kind == 15:
+            detail = '%d events lost' % v1
+        elif kind == 16:
+            detail = '%d panel reads failed, %d reports given up' % (v1, v2)
+        else:
+            detail = 'a=%d v1=%d v2=%d' % (a, v1, v2)
+        print('%12.3f ms  %-11s %s' % ((t - start) / 1000.0, what, detail))
+
+
+def report(records, skipped):
+    counts = {}
+    for r in records:
+        counts[r[0]] = counts.get(r[0], 0) + 1
+    span = (records[-1][2] - records[0][2]) / 1e6 if records else 0
+    lost = sum(r[3] for r in records if r[0] == 15)
+
+    print('BONK telemetry - %d records over %.1f s' % (len(records), span))
+    print('\n  bytes skipped       %d' % skipped)
+    print('  events lost         %d' % lost)
+    fails = [r for r in records if r[0] == 16]
+    if fails:
+        print('  touch read failures %d, %d reports given up' % (fails[-1][3], fails[-1][4]))
+    print('  events              %s' % ', '.join(
+        '%s %d' % (TYPES.get(k, k), counts[k]) for k in sorted(counts)))
+
+    hits = [r for r in records if r[0] == 5]
+    misses = [r for r in records if r[0] == 6]
+    grace = sum(1 for r in hits if r[1] & GRACE)
+    print('  taps in gameplay    %d hit (%d in grace), %d missed' % (len(hits), grace, len(misses)))
+    for k, kname in enumerate(KINDS):
+        spawned = sum(1 for r in records if r[0] == 7 and r[1] == k)
+        gone = sum(1 for r in records if r[0] == 8 and r[1] == k)
+        hit = sum(1 for r in hits if r[1] & ~GRACE == k)
+        print('  %-19s %d spawned, %d hit, %d left unhit' % (kname, spawned, hit, gone))
+
+    histogram('tap-to-hit latency (touch interrupt to hit decision)', [r[3] for r in hits])
+    histogram('tap-to-miss latency', [r[3] for r in misses])
+    histogram('touch queue delay (interrupt to loop)', [r[4] for r in records if r[0] == 4])
+
+    # Frames: pair each FRAME_END with the FRAME_BEGIN before it
+    flushUs, frameBytes, gaps = [], [], []
+    begin = lastBegin = None
+    for kind, a, t, v1, v2 in records:
+        if kind == 10:
+            if lastBegin is not None:
+                gaps.append(t - lastBegin)
+            begin = lastBegin = t
+        elif kind == 11 and begin is not None:
+            flushUs.append(t - begin)
+            frameBytes.append(v1)
+            begin = None
+        elif kind == 1:
+            begin = lastBegin = None
+    if frameBytes:
+        print('\n  frames              %d, %d bytes avg, %d max' % (
+            len(frameBytes), sum(frameBytes) // len(frameBytes), max(frameBytes)))
+    histogram('frame flush time', flushUs)
+    histogram('frame interval', gaps)
+
+    # Per-handler time, with the compositor flush alongside
+    calls = {}
+    for kind, a, t, v1, v2 in records:
+        if kind == 12:
+            calls.setdefault(name(HANDLERS, a), []).append(v1)
+    if flushUs:
+        calls['(frame flush)'] = flushUs
+    total = sum(sum(v) for v in calls.values())
+    print('\n  %-16s %8s %12s %10s %10s %7s' % ('handler', 'calls', 'total us', 'avg us', 'max us', '%'))
+    for h, v in sorted(calls.items(), key=lambda kv: -sum(kv[1])):
+        print('  %-16s %8d %12d %10.1f %10d %6.1f%%' % (
+            h, len(v), sum(v), sum(v) / len(v), max(v), 100.0 * sum(v) / total if total else 0))
+
+    for kind, a, t, v1, v2 in records:
+        if kind == 13:
+            print('\n  round end           %d SPI bytes in %d frames so far, sprite cache %d%% hits' % (v1, v2, a))
+
+
+def main():
+    signal.signal(signal.SIGPIPE, signal.SIG_DFL)
+    ap = argparse.ArgumentParser(description='Decode BONK REV8 binary telemetry')
+    ap.add_argument('capture', nargs='?', help="raw capture file, '-' for stdin")
+    ap.add_argument('--port', help='read from a serial port instead')
+    ap.add_argument('--baud', type=int, default=2000000)
+    ap.add_argument('--seconds', type=float, default=10.0, help='how long to read the port')
+    ap.add_argument('--request', action='store_true', help='ask an on-demand build to drain')
+    ap.add_argument('--events', action='store_true', help='print every record')
+    ap.add_argument('--strict', action='store_true', help='fail if any bytes were skipped')
+    args = ap.parse_args()
+
+    if args.port:
+        data = read_port(args)
+    elif args.capture == '-':
+        data = sys.stdin.buffer.read()
+    elif args.capture:
+        with open(args.capture, 'rb') as f:
+            data = f.read()
+    else:
+        ap.error('give a capture file or --port')
+
+    records, skipped = decode(data)
+    if args.events:
+        print_events(records)
+    else:
+        report(records, skipped)
+    if not records:
+        print('no telemetry records found', file=sys.stderr)
+        return 1
+    if args.strict and skipped:
+        print('%d bytes skipped' % skipped, file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())